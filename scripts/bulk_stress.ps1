@@ -1,19 +1,28 @@
 param(
   [string]$Config = "examples/config_directmap_fixed.yaml",
-  [string]$OutDir = "gen"
+  [string]$OutDir = "gen",
+  # Earlier tmp/stress_reports (or a copy of it): each DBC is compared with <BaselineDir>/<name>.json
+  [string]$BaselineDir = ""
 )
 
 $ErrorActionPreference = "Stop"
 
 function Invoke-Stress {
   param(
-    [string]$DbcPath
+    [string]$DbcPath,
+    [string]$Baseline
   )
   Write-Host "=== Processing DBC: $DbcPath ==="
 
-  dotnet run --project src/Generator -- --dbc "$DbcPath" --out "$OutDir" --config "$Config"
-  make -C "$OutDir" build
-  & "$OutDir/build/test_runner" "test_stress_suite"
+  # --harness (-t) writes the Makefile and the benchmark driver for every message in the DBC
+  dotnet run --project src/Signal.CANdy.CLI -- -d "$DbcPath" -o "$OutDir" -c "$Config" -t
+  if ($Baseline) {
+    make -C "$OutDir" bench BENCH_BASELINE="$Baseline"
+  } else {
+    make -C "$OutDir" bench
+  }
+  # make bench exits 3 when the driver finds a regression against the baseline
+  if ($LASTEXITCODE -ne 0) { Write-Output "make bench exit code: $LASTEXITCODE" }
 }
 
 # Collect DBCs from examples and external_test
@@ -30,18 +39,24 @@ if ($dbcFiles.Count -eq 0) {
   exit 1
 }
 
-# Optional: write simple reports
+# One report per DBC: the benchmark JSON plus the build/run log
 $reportRoot = Join-Path -Path (Resolve-Path ".").Path -ChildPath "tmp/stress_reports"
 New-Item -ItemType Directory -Path $reportRoot -Force | Out-Null
 
 foreach ($dbc in $dbcFiles) {
   $name = [IO.Path]::GetFileNameWithoutExtension($dbc)
   $report = Join-Path $reportRoot "$name.txt"
+  $baseline = ""
+  if ($BaselineDir) {
+    $candidate = Join-Path $BaselineDir "$name.json"
+    if (Test-Path $candidate) { $baseline = (Resolve-Path $candidate).Path }
+  }
   try {
     $sw = [System.Diagnostics.Stopwatch]::StartNew()
-    $output = Invoke-Stress -DbcPath $dbc 2>&1 | Out-String
+    $output = Invoke-Stress -DbcPath $dbc -Baseline $baseline 2>&1 | Out-String
     $sw.Stop()
     "DBC: $dbc`nTime: $($sw.Elapsed.ToString())`n--- Output ---`n$output" | Out-File -FilePath $report -Encoding UTF8
+    Copy-Item -Path (Join-Path $OutDir "build/bench.json") -Destination (Join-Path $reportRoot "$name.json") -Force
     Write-Host "Saved report -> $report" -ForegroundColor Green
   }
   catch {
@@ -9,48 +9,60 @@ if (!(Test-Path $ReportsDir)) {
   Write-Error "Reports directory not found: $ReportsDir"
 }
 
+function New-Row {
+  param(
+    [string]$Dbc,
+    [string]$Message,
+    [string]$Operation,
+    $Stat,
+    $Unstable
+  )
+  [pscustomobject]@{
+    DBC = $Dbc
+    Message = $Message
+    Operation = $Operation
+    NsPerOp = [double]$Stat.ns_op
+    Mad = [double]$Stat.mad
+    FramesPerSec = [double]$Stat.frames_s
+    P99 = [double]$Stat.p99
+    Unstable = $Unstable
+  }
+}
+
+# bulk_stress.ps1 copies each DBC's build/bench.json to <ReportsDir>/<name>.json
 $rows = @()
-$files = Get-ChildItem -Path $ReportsDir -Filter *.txt -File
+$files = Get-ChildItem -Path $ReportsDir -Filter *.json -File
 foreach ($f in $files) {
   $dbc = [IO.Path]::GetFileNameWithoutExtension($f.Name)
-  $lines = Get-Content -Path $f.FullName
-  $currentTest = $null
-  $timeSec = $null
-  $passed = $null
-  $failed = $null
-  $rate = $null
-  foreach ($line in $lines) {
-    if ($line -match '^Starting stress test: (.+) \(') {
-      $currentTest = $Matches[1].Trim()
-      $timeSec = $null; $passed = $null; $failed = $null; $rate = $null
-    }
-    elseif ($line -match '^  Time: ([0-9\.]+) seconds') {
-      $timeSec = [double]$Matches[1]
-    }
-    elseif ($line -match '^  Results: ([0-9]+) passed, ([0-9]+) failed') {
-      $passed = [int]$Matches[1]
-      $failed = [int]$Matches[2]
-    }
-    elseif ($line -match '^  Rate: ([0-9\.]+) ops/sec') {
-      $rate = [double]$Matches[1]
-      if ($currentTest) {
-        $rows += [pscustomobject]@{
-          DBC = $dbc
-          Test = $currentTest
-          TimeSec = $timeSec
-          Passed = $passed
-          Failed = $failed
-          RateOpsPerSec = $rate
-        }
+  try {
+    $report = Get-Content -Path $f.FullName -Raw | ConvertFrom-Json
+  }
+  catch {
+    Write-Warning "Skipping $($f.Name): not valid JSON"
+    continue
+  }
+  if ($null -eq $report.messages) {
+    Write-Warning "Skipping $($f.Name): not a bench report"
+    continue
+  }
+
+  foreach ($message in $report.messages) {
+    foreach ($op in @("decode", "encode", "roundtrip")) {
+      $stat = $message.$op
+      if ($null -ne $stat) {
+        $rows += New-Row -Dbc $dbc -Message $message.name -Operation $op -Stat $stat -Unstable $message.unstable
       }
     }
   }
+  if ($null -ne $report.registry -and $null -ne $report.registry.decode) {
+    $rows += New-Row -Dbc $dbc -Message "(registry)" -Operation "decode" -Stat $report.registry.decode -Unstable $report.unstable
+  }
 }
 
 if ($rows.Count -eq 0) {
-  Write-Warning "No test entries parsed. Check report format or directory."
+  Write-Warning "No bench results found. Run scripts/bulk_stress.ps1 first."
 }
 
 # Export CSV (UTF8)
-$rows | Sort-Object DBC, Test | Export-Csv -Path $OutCsv -NoTypeInformation -Encoding UTF8
+$rows | Sort-Object DBC, Message, Operation | Export-Csv -Path $OutCsv -NoTypeInformation -Encoding UTF8
 Write-Host "Saved summary -> $OutCsv" -ForegroundColor Green
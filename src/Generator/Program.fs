@@ -116,7 +116,21 @@ module Program =
                       CrcCounterCheck = false
                       MotorolaStartBit = "msb"
                       FilePrefix = "sc_"
-                      CrcCounter = None }
+                      CrcCounter = None
+                      RegistryCache = false
+                      Subscriptions = false
+                      TxScheduler = false
+                      RxMonitor = false
+                      RxTimeoutFactor = 3
+                      CrcPatch = false
+                      E2eSupervisor = false
+                      CppHeader = false
+                      CodegenStyle = "unrolled"
+                      DescriptorBlob = false
+                      LogDecoder = false
+                      ArrowWriter = false
+                      SocketCan = false
+                      EbpfSignals = [] }
 
                 let cfg =
                     match parsedArgs.ConfigPath with
@@ -35,7 +35,7 @@ module Cli =
               "  -d, --dbc <path>       Path to input DBC file (required)"
               "  -o, --out <dir>        Output directory for generated C files (required)"
               "  -c, --config <path>    Optional YAML config (phys_type, range_check, dispatch, etc.)"
-              "  -t, --harness          Generate test harness files (main.c + Makefile) if missing"
+              "  -t, --harness          Generate test harness files (main.c, Makefile, benchmark drivers)"
               "  -v, --version          Print library version and exit"
               "  -h, --help             Show this help and exit" ]
 
@@ -195,6 +195,16 @@ let main argv : int =
                             patchCommonSource "*utils.c" utilsHeader
                             patchCommonSource "*registry.c" registryHeader
 
+                            // Benchmark drivers: every message, and the bit accessors (make bench / make test)
+                            let benchRes =
+                                (Signal.CANdy.Core.Api.generateBenchmarkFromPaths dbc outDir cfgOpt)
+                                    .GetAwaiter()
+                                    .GetResult()
+
+                            match benchRes with
+                            | Ok paths -> paths |> List.iter (printfn "Harness: benchmark driver %s")
+                            | Error e -> eprintfn "Harness benchmark driver warning: %A" e
+
                             // Create or upgrade a Makefile to adapt to whatever files were generated
                             let mkPath = System.IO.Path.Combine(outDirFull, "Makefile")
 
@@ -216,12 +226,6 @@ INCLUDE_DIR = include
 
 # Discover all C sources under src and map to objects under build
 SRCS := $(wildcard $(SRC_DIR)/*.c)
-# Add stress test source if available
-ifneq (,$(wildcard ../examples/stress_test.c))
-SRCS += ../examples/stress_test.c
-CFLAGS += -DHAVE_STRESS
-endif
-
 # If any prefixed common files exist, drop legacy unprefixed ones to avoid duplicates
 ifneq (,$(filter-out $(SRC_DIR)/registry.c,$(wildcard $(SRC_DIR)/*registry.c)))
 SRCS := $(filter-out $(SRC_DIR)/registry.c,$(SRCS))
@@ -244,13 +248,37 @@ PRIMARY_REG := $(word 1,$(sort $(REG_SRCS)))
 SRCS := $(filter-out $(filter-out $(PRIMARY_REG),$(REG_SRCS)),$(SRCS))
 endif
 OBJS := $(patsubst $(SRC_DIR)/%.c,$(BUILD_DIR)/%.o,$(SRCS))
-OBJS := $(patsubst ../examples/%.c,$(BUILD_DIR)/%.o,$(OBJS))
 
 TARGET = $(BUILD_DIR)/test_runner
 
-.PHONY: all build test clean
+# CAN log decoder (config log_decoder: true); links the generated sources without main.c
+LOG_TOOL_SRC := $(wildcard tools/*log_decode.c)
+LOG_TOOL = $(BUILD_DIR)/log_decode
+LIB_OBJS := $(filter-out $(BUILD_DIR)/main.o,$(OBJS))
+
+# Benchmark driver (tools/*bench.c, written by --harness); compiled together with the generated
+# sources at BENCH_OPT so the numbers do not depend on how the test runner objects were built
+BENCH_SRC := $(wildcard tools/*bench.c)
+BENCH = $(BUILD_DIR)/bench
+BENCH_OPT ?= -O2
+BENCH_ARGS ?=
+# Earlier bench.json to compare with (make bench BENCH_BASELINE=old.json); bench exits 3 on a regression
+BENCH_BASELINE ?=
+BENCH_THRESHOLD ?= 5
+BENCH_FLAGS = $(strip $(CC) $(CFLAGS) $(BENCH_OPT) $(EXTRA_CFLAGS))
+LIB_SRCS := $(filter-out $(SRC_DIR)/main.c,$(SRCS))
 
-all: build
+# Bit accessor matrix and timing (tools/*bit_accessors.c); needs only the utils source
+ACCESSOR_SRC := $(wildcard tools/*bit_accessors.c)
+ACCESSORS = $(BUILD_DIR)/bit_accessors
+
+# eBPF socket filter (config ebpf_signals); not part of all, needs clang and the libbpf headers
+BPF_SRC := $(wildcard bpf/*can_bpf.bpf.c)
+BPF_OBJ := $(BPF_SRC:.c=.o)
+
+.PHONY: all build test bench clean log_decode can_bpf
+
+all: build $(if $(LOG_TOOL_SRC),log_decode)
 
 build: $(TARGET)
 
@@ -259,24 +287,49 @@ $(BUILD_DIR)/%.o: $(SRC_DIR)/%.c
 	mkdir -p $(@D)
 	$(CC) $(CFLAGS) $(EXTRA_CFLAGS) -I$(INCLUDE_DIR) -c $< -o $@
 
-# Rule for examples directory
-$(BUILD_DIR)/%.o: ../examples/%.c
-	mkdir -p $(@D)
-	$(CC) $(CFLAGS) $(EXTRA_CFLAGS) -I$(INCLUDE_DIR) -c $< -o $@
-
 # Link all objects into the test runner
 $(TARGET): $(OBJS)
 	mkdir -p $(@D)
 	$(CC) $(CFLAGS) $(EXTRA_CFLAGS) $(OBJS) $(LDLIBS) -o $@
 
-# Placeholder test target (adjust as needed)
+log_decode: $(LOG_TOOL)
+
+$(LOG_TOOL): $(LOG_TOOL_SRC) $(LIB_OBJS)
+	mkdir -p $(@D)
+	$(CC) $(CFLAGS) -O2 -pthread $(EXTRA_CFLAGS) -I$(INCLUDE_DIR) $(LOG_TOOL_SRC) $(LIB_OBJS) $(LDLIBS) -o $@
+
+can_bpf: $(BPF_OBJ)
+
+bpf/%.bpf.o: bpf/%.bpf.c
+	clang -O2 -g -target bpf -c $< -o $@
+
+$(BENCH): $(BENCH_SRC) $(LIB_SRCS)
+	mkdir -p $(@D)
+	$(CC) $(CFLAGS) $(BENCH_OPT) $(EXTRA_CFLAGS) -DBENCH_CFLAGS='"$(BENCH_FLAGS)"' -I$(INCLUDE_DIR) $(BENCH_SRC) $(LIB_SRCS) $(LDLIBS) -o $@
+
+$(ACCESSORS): $(ACCESSOR_SRC) $(PRIMARY_UTIL)
+	mkdir -p $(@D)
+	$(CC) $(CFLAGS) $(BENCH_OPT) $(EXTRA_CFLAGS) -I$(INCLUDE_DIR) $(ACCESSOR_SRC) $(PRIMARY_UTIL) $(LDLIBS) -o $@
+
+# Timed decode/encode/roundtrip per message and via decode_message, and bit accessor timings; JSON reports
+bench: $(BENCH) $(if $(ACCESSOR_SRC),$(ACCESSORS))
+	$(BENCH) $(BENCH_ARGS) $(if $(BENCH_BASELINE),-c $(BENCH_BASELINE) -t $(BENCH_THRESHOLD)) -o $(BUILD_DIR)/bench.json
+	$(if $(ACCESSOR_SRC),$(ACCESSORS) -o $(BUILD_DIR)/bit_accessors.json)
+	@echo "Benchmark reports: $(BUILD_DIR)/bench.json$(if $(ACCESSOR_SRC), $(BUILD_DIR)/bit_accessors.json)"
+
+# Short benchmark run over every message, which fails when a valid payload does not roundtrip,
+# and the full bit accessor matrix
+ifneq ($(strip $(BENCH_SRC)),)
+test: $(BENCH) $(if $(ACCESSOR_SRC),$(ACCESSORS))
+	$(BENCH) --check -o $(BUILD_DIR)/bench_check.json
+	$(if $(ACCESSOR_SRC),$(ACCESSORS) --check -o $(BUILD_DIR)/bit_accessors_check.json)
+else
 test:
-	@echo "Running C tests... (Placeholder)"
-	@echo "No actual tests implemented yet. This is a placeholder."
-	# For example: ./$(TARGET) test_be_basic
+	@echo "No benchmark driver in tools/; rerun the generator with --harness (-t)."
+endif
 
 clean:
-	rm -rf $(BUILD_DIR)
+	rm -rf $(BUILD_DIR) $(BPF_OBJ)
 """
 
                             let writeMk () = System.IO.File.WriteAllText(mkPath, mk)
@@ -25,6 +25,49 @@ let generateCode (ir: Ir) (outputPath: string) (config: Config) : Result<Generat
 let generateCodeAsync (ir: Ir) (outputPath: string) (config: Config) : Task<Result<GeneratedFiles, CodeGenError>> =
     task { return generateCode ir outputPath config }
 
+// Load config (optional path -> YAML; otherwise sensible defaults), parse the DBC and validate one against the other.
+let private loadInputs (dbcPath: string) (configPath: string option) : Result<Ir * Config, GenerateError> =
+    let configResult: Result<Config, GenerateError> =
+        match configPath with
+        | Some p ->
+            match Signal.CANdy.Core.Config.loadFromYaml p with
+            | Ok cfg -> Ok cfg
+            | Error ve -> Error(GenerateError.Validation ve)
+        | None ->
+            Ok
+                { PhysType = "float"
+                  PhysMode = "double"
+                  RangeCheck = false
+                  Dispatch = "binary_search"
+                  CrcCounterCheck = false
+                  MotorolaStartBit = "msb"
+                  FilePrefix = "sc_"
+                  CrcCounter = None
+                  RegistryCache = false
+                  Subscriptions = false
+                  TxScheduler = false
+                  RxMonitor = false
+                  RxTimeoutFactor = 3
+                  CrcPatch = false
+                  E2eSupervisor = false
+                  CppHeader = false
+                  CodegenStyle = "unrolled"
+                  DescriptorBlob = false
+                  LogDecoder = false
+                  ArrowWriter = false
+                  SocketCan = false
+                  EbpfSignals = [] }
+
+    match configResult with
+    | Error e -> Error e
+    | Ok cfg ->
+        match Signal.CANdy.Core.Dbc.parseDbcFile dbcPath with
+        | Error pe -> Error(GenerateError.Parse pe)
+        | Ok ir ->
+            match Signal.CANdy.Core.Config.validateAgainstIr cfg ir with
+            | Error ve -> Error(GenerateError.Validation ve)
+            | Ok cfg -> Ok(ir, cfg)
+
 /// Convenience: parse dbc, load config path (optional), and generate.
 let generateFromPaths
     (dbcPath: string)
@@ -32,33 +75,33 @@ let generateFromPaths
     (configPath: string option)
     : Task<Result<GeneratedFiles, GenerateError>> =
     task {
-        // Load config (optional path -> YAML; otherwise sensible defaults)
-        let configResult: Result<Config, GenerateError> =
-            match configPath with
-            | Some p ->
-                match Signal.CANdy.Core.Config.loadFromYaml p with
-                | Ok cfg -> Ok cfg
-                | Error ve -> Error(GenerateError.Validation ve)
-            | None ->
-                Ok
-                    { PhysType = "float"
-                      PhysMode = "double"
-                      RangeCheck = false
-                      Dispatch = "binary_search"
-                      CrcCounterCheck = false
-                      MotorolaStartBit = "msb"
-                      FilePrefix = "sc_"
-                      CrcCounter = None }
+        match loadInputs dbcPath configPath with
+        | Error e -> return Error e
+        | Ok(ir, cfg) ->
+            // Delegate to codegen
+            match generateCode ir outputPath cfg with
+            | Ok files -> return Ok files
+            | Error ce -> return Error(GenerateError.CodeGen ce)
+    }
 
-        match configResult with
+/// Write the benchmark drivers for the code generated from the same inputs: tools/<prefix>bench.c
+/// (per-message decode/encode) and tools/<prefix>bit_accessors.c (bit accessor matrix).
+/// Returns the paths of the driver sources.
+let generateBenchmarkFromPaths
+    (dbcPath: string)
+    (outputPath: string)
+    (configPath: string option)
+    : Task<Result<string list, GenerateError>> =
+    task {
+        match loadInputs dbcPath configPath with
         | Error e -> return Error e
-        | Ok cfg ->
-            // Parse DBC
-            match Signal.CANdy.Core.Dbc.parseDbcFile dbcPath with
-            | Error pe -> return Error(GenerateError.Parse pe)
-            | Ok ir ->
-                // Delegate to codegen
-                match generateCode ir outputPath cfg with
-                | Ok files -> return Ok files
-                | Error ce -> return Error(GenerateError.CodeGen ce)
+        | Ok(ir, cfg) ->
+            try
+                return
+                    Ok
+                        [ Bench.generateBenchmark ir outputPath cfg
+                          Bench.generateAccessorSuite outputPath cfg ]
+            with
+            | TemplateRenderException msg -> return Error(GenerateError.CodeGen(CodeGenError.TemplateError msg))
+            | ex -> return Error(GenerateError.CodeGen(CodeGenError.IoError ex.Message))
     }
@@ -82,24 +82,346 @@ module Codegen =
                 config.Dispatch
                 config.MotorolaStartBit
 
+        let private usesCrcAlgorithm (ir: Ir) (algorithm: CrcAlgorithmId) =
+            ir.Messages
+            |> List.exists (fun msg ->
+                msg.Signals
+                |> List.exists (fun s ->
+                    match s.CrcMeta with
+                    | Some meta -> meta.Algorithm = algorithm
+                    | None -> false))
+
+        let private crcParamsFor (ir: Ir) (algorithm: CrcAlgorithmId) =
+            ir.Messages
+            |> List.tryPick (fun msg ->
+                msg.Signals
+                |> List.tryPick (fun s ->
+                    match s.CrcMeta with
+                    | Some meta when meta.Algorithm = algorithm -> Some meta.Params
+                    | _ -> None))
+
+        let private reflectBits (width: int) (value: uint64) =
+            let mutable r = 0UL
+
+            for i in 0 .. width - 1 do
+                if (value >>> i) &&& 1UL <> 0UL then
+                    r <- r ||| (1UL <<< (width - 1 - i))
+
+            r
+
+        /// Slice-by-N lookup tables. Table 0 is the classic byte-at-a-time table; table k is
+        /// table 0 advanced by k zero bytes, so a kernel can fold N input bytes per step.
+        let crcSliceTables (p: CrcAlgorithmParams) (slices: int) : uint64[][] =
+            let mask = if p.Width = 64 then UInt64.MaxValue else (1UL <<< p.Width) - 1UL
+            let top = 1UL <<< (p.Width - 1)
+            let rpoly = reflectBits p.Width p.Poly
+
+            let byteStep (i: int) =
+                let mutable c =
+                    if p.ReflectIn then uint64 i else (uint64 i <<< (p.Width - 8)) &&& mask
+
+                for _ in 1..8 do
+                    c <-
+                        if p.ReflectIn then
+                            (if c &&& 1UL <> 0UL then (c >>> 1) ^^^ rpoly else c >>> 1)
+                        else
+                            (if c &&& top <> 0UL then (c <<< 1) ^^^ p.Poly else c <<< 1) &&& mask
+
+                c
+
+            let t0 = Array.init 256 byteStep
+            let tables = Array.zeroCreate<uint64[]> slices
+            tables.[0] <- t0
+
+            for k in 1 .. slices - 1 do
+                tables.[k] <-
+                    tables.[k - 1]
+                    |> Array.map (fun prev ->
+                        if p.ReflectIn then
+                            (prev >>> 8) ^^^ t0.[int (prev &&& 0xFFUL)]
+                        else
+                            ((prev <<< 8) &&& mask) ^^^ t0.[int (prev >>> (p.Width - 8))])
+
+            tables
+
+        /// Renders slice tables as a C initializer body ({ {..}, {..} }), 8 entries per line.
+        let formatCrcTables (digits: int) (tables: uint64[][]) =
+            let sb = System.Text.StringBuilder()
+            sb.Append("{\n") |> ignore
+
+            for table in tables do
+                sb.Append("    {\n") |> ignore
+
+                table
+                |> Array.chunkBySize 8
+                |> Array.iter (fun row ->
+                    let cells = row |> Array.map (fun v -> "0x" + v.ToString("X" + string digits))
+                    sb.Append("        ").Append(String.Join(", ", cells)).Append(",\n") |> ignore)
+
+                sb.Append("    },\n") |> ignore
+
+            sb.Append("}").ToString()
+
+        /// PCLMULQDQ fold multiplier for a reflected 32-bit CRC: (x^exponent mod P) bit-reflected, shifted left by one.
+        let crcFoldConstant (p: CrcAlgorithmParams) (exponent: int) =
+            let full = (1UL <<< 32) ||| p.Poly
+            let mutable r = 1UL
+
+            for _ in 1..exponent do
+                r <- r <<< 1
+
+                if r &&& (1UL <<< 32) <> 0UL then
+                    r <- r ^^^ full
+
+            reflectBits 32 r <<< 1
+
+        /// Register state before the first byte; reflected algorithms keep the register LSB-first.
+        let crcInitRegister (p: CrcAlgorithmParams) =
+            if p.ReflectIn then reflectBits p.Width p.Init else p.Init
+
+        /// Register state after feeding `bytes` from the init value, without the final reflect/XOR.
+        /// Used to fold a message Data ID into a constant seed at generation time.
+        let crcRegisterAfter (p: CrcAlgorithmParams) (bytes: byte list) =
+            let mask = if p.Width = 64 then UInt64.MaxValue else (1UL <<< p.Width) - 1UL
+            let t0 = (crcSliceTables p 1).[0]
+
+            bytes
+            |> List.fold
+                (fun reg b ->
+                    if p.ReflectIn then
+                        (reg >>> 8) ^^^ t0.[int ((reg ^^^ uint64 b) &&& 0xFFUL)]
+                    else
+                        ((reg <<< 8) &&& mask) ^^^ t0.[int (((reg >>> (p.Width - 8)) ^^^ uint64 b) &&& 0xFFUL)])
+                (crcInitRegister p)
+
+        /// CRC value for a register state: output reflection (when it differs from input) and final XOR applied.
+        let crcFinalize (p: CrcAlgorithmParams) (reg: uint64) =
+            let mask = if p.Width = 64 then UInt64.MaxValue else (1UL <<< p.Width) - 1UL
+
+            let r =
+                if p.ReflectIn <> p.ReflectOut then
+                    reflectBits p.Width reg
+                else
+                    reg
+
+            (r ^^^ p.XorOut) &&& mask
+
+        /// Data ID bytes hashed ahead of the payload: low byte, then high byte.
+        let dataIdBytes (dataId: uint16) =
+            [ byte (dataId &&& 0xFFus); byte (dataId >>> 8) ]
+
+        /// C function name of a custom (YAML `algorithms:`) CRC-8.
+        let customCrcFuncName (name: string) =
+            sprintf "sc_crc8_%s" (name.ToLowerInvariant().Replace("-", "_"))
+
+        let private customCrcAlgorithms (ir: Ir) =
+            ir.Messages
+            |> List.collect (fun msg ->
+                msg.Signals
+                |> List.choose (fun s ->
+                    match s.CrcMeta with
+                    | Some({ Algorithm = CrcAlgorithmId.Custom name } as meta) -> Some(name, meta.Params)
+                    | _ -> None))
+            |> List.distinctBy fst
+            |> List.sortBy fst
+
+        let private customCrcDecls (ir: Ir) =
+            customCrcAlgorithms ir
+            |> List.map (fun (name, _) ->
+                let funcName = customCrcFuncName name
+
+                sprintf
+                    "uint8_t %s(const uint8_t* data, size_t len);\nuint8_t %s_seeded(uint8_t crc, const uint8_t* data, size_t len);\n"
+                    funcName
+                    funcName)
+            |> String.concat ""
+
+        // Table and init are synthesized here so the runtime loop is the same single lookup as the builtin CRC-8s.
+        let private customCrcImpl (name: string, p: CrcAlgorithmParams) =
+            let funcName = customCrcFuncName name
+            let table = (crcSliceTables p 1).[0]
+
+            let rows =
+                table
+                |> Array.chunkBySize 16
+                |> Array.map (fun row ->
+                    "    "
+                    + (row |> Array.map (fun v -> sprintf "0x%02X," v) |> String.concat " "))
+                |> String.concat "\n"
+
+            let initReg = crcInitRegister p &&& 0xFFUL
+
+            let finish =
+                if p.ReflectIn <> p.ReflectOut then
+                    sprintf
+                        "    uint8_t out = 0;\n    for (int b = 0; b < 8; ++b) {\n        out = (uint8_t)((out << 1) | ((crc >> b) & 1u));\n    }\n    return (uint8_t)(out ^ 0x%02X);"
+                        (p.XorOut &&& 0xFFUL)
+                else
+                    sprintf "    return (uint8_t)(crc ^ 0x%02X);" (p.XorOut &&& 0xFFUL)
+
+            sprintf
+                "/* Custom CRC-8 '%s': poly 0x%02X, init 0x%02X, xor_out 0x%02X, reflect_in=%b, reflect_out=%b */\nstatic const uint8_t %s_table[256] = {\n%s\n};\nuint8_t %s_seeded(uint8_t crc, const uint8_t* data, size_t len) {\n    for (size_t i = 0; i < len; ++i) {\n        crc = %s_table[crc ^ data[i]];\n    }\n%s\n}\nuint8_t %s(const uint8_t* data, size_t len) {\n    return %s_seeded(0x%02X, data, len);\n}\n"
+                name
+                (p.Poly &&& 0xFFUL)
+                (p.Init &&& 0xFFUL)
+                (p.XorOut &&& 0xFFUL)
+                p.ReflectIn
+                p.ReflectOut
+                funcName
+                rows
+                funcName
+                funcName
+                finish
+                funcName
+                funcName
+                initReg
+
+        // codegen_style: table replaces the unrolled per-signal code with const descriptors that a single
+        // interpreter in utils.c walks. The scale entry only carries the fields the configuration needs.
+        let isTableStyle (config: Signal.CANdy.Core.Config.Config) =
+            config.CodegenStyle.ToLowerInvariant() = "table"
+
+        let private tableUsesDivisor (config: Signal.CANdy.Core.Config.Config) =
+            config.PhysType.ToLowerInvariant() = "fixed"
+
+        let private tableTypeDecls (config: Signal.CANdy.Core.Config.Config) =
+            [ "/* Table-driven decoding (codegen_style: table): one descriptor per signal, scales shared per message */"
+              "#define SC_SIG_BE 0x01u"
+              "#define SC_SIG_SIGNED 0x02u"
+              ""
+              "typedef struct {"
+              "    uint16_t field;  /* byte offset of the float member in <MSG>_t */"
+              "    uint16_t start;  /* effective start bit for get_bits_le / get_bits_be */"
+              "    uint8_t length;"
+              "    uint8_t flags;   /* SC_SIG_BE | SC_SIG_SIGNED */"
+              "    uint16_t scale;  /* index into the message's sc_scale_t table */"
+              "} sc_signal_desc_t;"
+              ""
+              "typedef struct {"
+              "    double factor;"
+              "    double offset;"
+              if config.RangeCheck then
+                  "    double min;"
+                  "    double max;"
+              if tableUsesDivisor config then
+                  "    int32_t divisor; /* > 0: decimal fixed-point path, offset pre-scaled by divisor */"
+              "} sc_scale_t;"
+              ""
+              "int64_t sc_table_raw(const sc_signal_desc_t* desc, const uint8_t data[]);"
+              "int64_t sc_table_to_raw(const sc_signal_desc_t* desc, const sc_scale_t* scales, const void* msg);"
+              "bool sc_table_decode(const sc_signal_desc_t* desc, size_t count, const sc_scale_t* scales, const uint8_t data[], void* msg);"
+              "bool sc_table_encode(const sc_signal_desc_t* desc, size_t count, const sc_scale_t* scales, uint8_t data[], const void* msg);" ]
+            |> String.concat "\n"
+
+        let private tableInterpreterImpl (config: Signal.CANdy.Core.Config.Config) =
+            // Same choice as physAssign/computeRaw in the unrolled backend: fixed only takes
+            // fixed_float (for scales without a decimal divisor), float only takes float.
+            let floatMath =
+                match config.PhysType.ToLowerInvariant(), config.PhysMode.ToLowerInvariant() with
+                | "fixed", "fixed_float" -> true
+                | "fixed", _ -> false
+                | _, "float" -> true
+                | _ -> false
+
+            let decodeScaled, encodeScaled =
+                if floatMath then
+                    [ "        float x = (d->flags & SC_SIG_SIGNED) ? (float)raw : (float)(uint64_t)raw;"
+                      "        *field = (float)((x * (float)s->factor) + (float)s->offset);" ],
+                    [ "        float tmp = ((float)v - (float)s->offset) / (float)s->factor;"
+                      "        raw = (int64_t)llroundf(tmp);" ]
+                else
+                    [ "        double x = (d->flags & SC_SIG_SIGNED) ? (double)raw : (double)(uint64_t)raw;"
+                      "        *field = (float)(x * s->factor + s->offset);" ],
+                    [ "        double tmp = ((double)v - s->offset) / s->factor;"
+                      "        raw = (int64_t)(tmp >= 0 ? tmp + 0.5 : tmp - 0.5);" ]
+
+            let indent (lines: string list) = lines |> List.map (fun l -> "    " + l)
+
+            let decodeBody, encodeBody =
+                if tableUsesDivisor config then
+                    [ "        if (s->divisor > 0) {"
+                      "            double x = (d->flags & SC_SIG_SIGNED) ? (double)raw : (double)(uint64_t)raw;"
+                      "            *field = (float)((x + s->offset) / (double)s->divisor);"
+                      "        } else {"
+                      yield! indent decodeScaled
+                      "        }" ],
+                    [ "        if (s->divisor > 0) {"
+                      "            raw = (int64_t)llround(((double)v - s->offset / (double)s->divisor) * (double)s->divisor);"
+                      "        } else {"
+                      yield! indent encodeScaled
+                      "        }" ]
+                else
+                    decodeScaled, encodeScaled
+
+            let rangeCheck value =
+                if config.RangeCheck then
+                    [ sprintf "        if (%s < s->min || %s > s->max) { return false; }" value value ]
+                else
+                    []
+
+            [ "#include <math.h>"
+              ""
+              "int64_t sc_table_raw(const sc_signal_desc_t* desc, const uint8_t data[]) {"
+              "    uint64_t raw = (desc->flags & SC_SIG_BE) ? get_bits_be(data, desc->start, desc->length)"
+              "                                             : get_bits_le(data, desc->start, desc->length);"
+              "    if ((desc->flags & SC_SIG_SIGNED) && desc->length < 64 && (raw & (1ULL << (desc->length - 1)))) {"
+              "        raw |= ~((1ULL << desc->length) - 1);"
+              "    }"
+              "    return (int64_t)raw;"
+              "}"
+              ""
+              "bool sc_table_decode(const sc_signal_desc_t* desc, size_t count, const sc_scale_t* scales, const uint8_t data[], void* msg) {"
+              "    for (size_t i = 0; i < count; ++i) {"
+              "        const sc_signal_desc_t* d = &desc[i];"
+              "        const sc_scale_t* s = &scales[d->scale];"
+              "        float* field = (float*)((uint8_t*)msg + d->field);"
+              "        int64_t raw = sc_table_raw(d, data);"
+              yield! decodeBody
+              yield! rangeCheck "*field"
+              "    }"
+              "    return true;"
+              "}"
+              ""
+              "int64_t sc_table_to_raw(const sc_signal_desc_t* desc, const sc_scale_t* scales, const void* msg) {"
+              "    const sc_scale_t* s = &scales[desc->scale];"
+              "    float v = *(const float*)((const uint8_t*)msg + desc->field);"
+              "    int64_t raw;"
+              yield! encodeBody |> List.map (fun l -> l.Substring 4)
+              "    return raw;"
+              "}"
+              ""
+              "bool sc_table_encode(const sc_signal_desc_t* desc, size_t count, const sc_scale_t* scales, uint8_t data[], const void* msg) {"
+              "    for (size_t i = 0; i < count; ++i) {"
+              "        const sc_signal_desc_t* d = &desc[i];"
+              yield!
+                  (if config.RangeCheck then
+                       [ "        const sc_scale_t* s = &scales[d->scale];"
+                         "        float v = *(const float*)((const uint8_t*)msg + d->field);" ]
+                       @ rangeCheck "v"
+                   else
+                       [])
+              "        int64_t raw = sc_table_to_raw(d, scales, msg);"
+              "        if (d->flags & SC_SIG_BE) {"
+              "            set_bits_be(data, d->start, d->length, (uint64_t)raw);"
+              "        } else {"
+              "            set_bits_le(data, d->start, d->length, (uint64_t)raw);"
+              "        }"
+              "    }"
+              "    return true;"
+              "}" ]
+            |> String.concat "\n"
+
         let utilsHContent (config: Signal.CANdy.Core.Config.Config) (ir: Ir) =
-            let hasCrcJ1850 =
-                ir.Messages
-                |> List.exists (fun msg ->
-                    msg.Signals
-                    |> List.exists (fun s ->
-                        match s.CrcMeta with
-                        | Some meta -> meta.Algorithm = CrcAlgorithmId.CRC8_SAE_J1850
-                        | None -> false))
-
-            let hasCrc8h2f =
+            let hasCrcJ1850 = usesCrcAlgorithm ir CrcAlgorithmId.CRC8_SAE_J1850
+            let hasCrc8h2f = usesCrcAlgorithm ir CrcAlgorithmId.CRC8_8H2F
+            let hasCrc16Ccitt = usesCrcAlgorithm ir CrcAlgorithmId.CRC16_CCITT
+            let hasCrc32p4 = usesCrcAlgorithm ir CrcAlgorithmId.CRC32P4
+
+            let hasE2e =
                 ir.Messages
-                |> List.exists (fun msg ->
-                    msg.Signals
-                    |> List.exists (fun s ->
-                        match s.CrcMeta with
-                        | Some meta -> meta.Algorithm = CrcAlgorithmId.CRC8_8H2F
-                        | None -> false))
+                |> List.exists (fun m ->
+                    m.CrcCounterMode = Some CrcCounterMode.Validate
+                    && m.Signals |> List.exists (fun s -> s.CrcMeta.IsSome || s.CounterMeta.IsSome))
 
             let hasValidArray =
                 ir.Messages
@@ -128,34 +450,62 @@ module Codegen =
                   "canfd_len_to_dlc_decl", box "uint8_t canfd_len_to_dlc(uint8_t len);"
                   "has_valid_array", box hasValidArray
                   "has_crc_j1850", box hasCrcJ1850
-                  "has_crc_8h2f", box hasCrc8h2f ]
+                  "has_crc_8h2f", box hasCrc8h2f
+                  "has_crc16_ccitt", box hasCrc16Ccitt
+                  "has_crc32p4", box hasCrc32p4
+                  "has_custom_crc", box (not (List.isEmpty (customCrcAlgorithms ir)))
+                  "custom_crc_decls", box (customCrcDecls ir)
+                  "has_e2e", box hasE2e
+                  "table_style", box (isTableStyle config)
+                  "table_type_decls", box (tableTypeDecls config)
+                  "prof_message_count", box (max 1 ir.Messages.Length) ]
 
             Templates.renderOrRaise "utils.h.scriban" model
 
         let utilsCContent (config: Signal.CANdy.Core.Config.Config) (ir: Ir) =
-            let hasCrcJ1850 =
-                ir.Messages
-                |> List.exists (fun msg ->
-                    msg.Signals
-                    |> List.exists (fun s ->
-                        match s.CrcMeta with
-                        | Some meta -> meta.Algorithm = CrcAlgorithmId.CRC8_SAE_J1850
-                        | None -> false))
-
-            let hasCrc8h2f =
-                ir.Messages
-                |> List.exists (fun msg ->
-                    msg.Signals
-                    |> List.exists (fun s ->
-                        match s.CrcMeta with
-                        | Some meta -> meta.Algorithm = CrcAlgorithmId.CRC8_8H2F
-                        | None -> false))
+            let hasCrcJ1850 = usesCrcAlgorithm ir CrcAlgorithmId.CRC8_SAE_J1850
+            let hasCrc8h2f = usesCrcAlgorithm ir CrcAlgorithmId.CRC8_8H2F
+            let hasCrc16Ccitt = usesCrcAlgorithm ir CrcAlgorithmId.CRC16_CCITT
+            let hasCrc32p4 = usesCrcAlgorithm ir CrcAlgorithmId.CRC32P4
+
+            let crc16Table =
+                crcParamsFor ir CrcAlgorithmId.CRC16_CCITT
+                |> Option.map (fun p -> formatCrcTables 4 (crcSliceTables p 4))
+                |> Option.defaultValue ""
+
+            // CRC-32/P4 uses slice-by-8 plus the two 128-bit fold multipliers of the PCLMULQDQ path
+            let crc32p4 = crcParamsFor ir CrcAlgorithmId.CRC32P4
+
+            let crc32Table =
+                crc32p4
+                |> Option.map (fun p -> formatCrcTables 8 (crcSliceTables p 8))
+                |> Option.defaultValue ""
+
+            let crc32FoldLo =
+                crc32p4
+                |> Option.map (fun p -> sprintf "0x%09X" (crcFoldConstant p 160))
+                |> Option.defaultValue ""
+
+            let crc32FoldHi =
+                crc32p4
+                |> Option.map (fun p -> sprintf "0x%09X" (crcFoldConstant p 96))
+                |> Option.defaultValue ""
 
             let model: (string * obj) list =
                 [ "banner", box (banner config)
                   "utils_header_name", box (utilsHeaderName config)
                   "has_crc_j1850", box hasCrcJ1850
-                  "has_crc_8h2f", box hasCrc8h2f ]
+                  "has_crc_8h2f", box hasCrc8h2f
+                  "has_crc16_ccitt", box hasCrc16Ccitt
+                  "has_crc32p4", box hasCrc32p4
+                  "crc16_ccitt_table", box crc16Table
+                  "crc32p4_table", box crc32Table
+                  "crc32p4_fold_lo", box crc32FoldLo
+                  "crc32p4_fold_hi", box crc32FoldHi
+                  "has_custom_crc", box (not (List.isEmpty (customCrcAlgorithms ir)))
+                  "custom_crc_impls", box (customCrcAlgorithms ir |> List.map customCrcImpl |> String.concat "\n")
+                  "table_style", box (isTableStyle config)
+                  "table_interpreter_impl", box (tableInterpreterImpl config) ]
 
             Templates.renderOrRaise "utils.c.scriban" model
 
@@ -192,6 +542,45 @@ module Codegen =
                 | _ -> start // default "msb"
             | _ -> start
 
+        // Payload bits of a signal holding the given raw value (bit b of byte i set when the signal
+        // occupies that bit and the matching raw bit is 1). Walks bits exactly like get_bits_le /
+        // get_bits_be: little-endian starts at the raw LSB, big-endian at the raw MSB.
+        let signalPayloadPattern
+            (signal: Signal)
+            (config: Signal.CANdy.Core.Config.Config)
+            (payloadLength: int)
+            (raw: uint64)
+            : byte[] =
+            let mask = Array.zeroCreate<byte> payloadLength
+            let startEff = chooseStartBit signal config
+            let len = int signal.Length
+
+            let setBit rawBit byteIdx bitIdx =
+                if byteIdx >= 0 && byteIdx < payloadLength && (raw >>> rawBit) &&& 1UL = 1UL then
+                    mask.[byteIdx] <- mask.[byteIdx] ||| (1uy <<< bitIdx)
+
+            match signal.ByteOrder with
+            | ByteOrder.Little ->
+                for i in 0 .. len - 1 do
+                    setBit i ((startEff + i) / 8) ((startEff + i) % 8)
+            | ByteOrder.Big ->
+                for i in 0 .. len - 1 do
+                    let mutable curByte = startEff / 8
+                    let mutable curBit = startEff % 8 - i
+
+                    while curBit < 0 do
+                        curBit <- curBit + 8
+                        curByte <- curByte + 1
+
+                    setBit (len - 1 - i) curByte curBit
+
+            mask
+
+        // Bit footprint of a signal as a per-byte payload mask (bit b of byte i set when the signal
+        // occupies that bit).
+        let signalPayloadMask (signal: Signal) (config: Signal.CANdy.Core.Config.Config) (payloadLength: int) : byte[] =
+            signalPayloadPattern signal config payloadLength UInt64.MaxValue
+
         // Detect if factor equals 10^-n within tolerance and return integer scale (10^n)
         let tryPowerOfTenScale (factor: float) : int64 option =
             if factor <= 0.0 then
@@ -256,6 +645,48 @@ module Codegen =
                 || matchesSignedRawCountRange
                 || matchesSignedUnsignedPhysicalRange)
 
+        /// C initializer for a signal's scale entry; identical entries are shared within a message.
+        let tableScaleEntry (signal: Signal) (config: Signal.CANdy.Core.Config.Config) =
+            let decimalScale =
+                if tableUsesDivisor config then
+                    match tryPowerOfTenScale signal.Factor with
+                    | Some scale when abs (signal.Offset - Math.Round(signal.Offset)) < 1e-12 -> Some scale
+                    | _ -> None
+                else
+                    None
+
+            let factorOffset =
+                match decimalScale with
+                | Some scale -> sprintf "%.17g, %.0f" signal.Factor (Math.Round(signal.Offset * float scale))
+                | None -> sprintf "%.17g, %.17g" signal.Factor signal.Offset
+
+            let bound (v: float) = sprintf "%.17g" v
+
+            let range =
+                if config.RangeCheck then
+                    let lo, hi =
+                        match signal.Minimum, signal.Maximum with
+                        | Some minV, Some maxV when
+                            minV < maxV
+                            && not (isRawRangeSentinel minV maxV signal.Factor signal.Offset signal.Length signal.IsSigned)
+                            ->
+                            bound minV, bound maxV
+                        | Some minV, None -> bound minV, "HUGE_VAL"
+                        | None, Some maxV -> "-HUGE_VAL", bound maxV
+                        | _ -> "-HUGE_VAL", "HUGE_VAL"
+
+                    sprintf ", %s, %s" lo hi
+                else
+                    ""
+
+            let divisor =
+                if tableUsesDivisor config then
+                    sprintf ", %d" (decimalScale |> Option.map int |> Option.defaultValue 0)
+                else
+                    ""
+
+            sprintf "{ %s%s%s }" factorOffset range divisor
+
     module Message =
         open Utils
 
@@ -297,7 +728,7 @@ module Codegen =
 
         let private fieldDecl (s: Signal) = sprintf "    float %s;" s.Name
 
-        let private genDecodeForSignal (s: Signal) (doRangeCheck: bool) (config: Signal.CANdy.Core.Config.Config) =
+        let internal genDecodeForSignal (s: Signal) (doRangeCheck: bool) (config: Signal.CANdy.Core.Config.Config) =
             let len = int s.Length
             let startEff = chooseStartBit s config
             let (getFn, _) = accessorNames s.ByteOrder
@@ -457,7 +888,7 @@ module Codegen =
               yield setBits ]
             |> String.concat "\n"
 
-        let private partitionMultiplex (message: Message) =
+        let internal partitionMultiplex (message: Message) =
             let switchOpt =
                 message.Signals |> List.tryFind (fun s -> s.MultiplexerIndicator = Some "M")
 
@@ -475,7 +906,38 @@ module Codegen =
 
             switchOpt, baseSignals, branches
 
-        let generateMessageFiles (message: Message) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+        let internal crcFuncName (meta: CrcSignalMeta) =
+            match meta.Algorithm with
+            | CrcAlgorithmId.CRC8_SAE_J1850 -> "sc_crc8_sae_j1850"
+            | CrcAlgorithmId.CRC8_8H2F -> "sc_crc8_8h2f"
+            | CrcAlgorithmId.CRC16_CCITT -> "sc_crc16_ccitt"
+            | CrcAlgorithmId.CRC32P4 -> "sc_crc32_p4"
+            | CrcAlgorithmId.Custom name -> Utils.customCrcFuncName name
+
+        // With a Data ID the register state after its two bytes is a per-message constant, so the
+        // generated call starts from that seed and the per-frame cost matches the plain CRC.
+        let internal crcCall (meta: CrcSignalMeta) =
+            let byteCount = meta.ByteRange.End - meta.ByteRange.Start + 1
+
+            match meta.DataId with
+            | Some dataId ->
+                let seed = Utils.crcRegisterAfter meta.Params (Utils.dataIdBytes dataId)
+
+                sprintf
+                    "%s_seeded(0x%0*X, &data[%d], %d)"
+                    (crcFuncName meta)
+                    (meta.Params.Width / 4)
+                    seed
+                    meta.ByteRange.Start
+                    byteCount
+            | None -> sprintf "%s(&data[%d], %d)" (crcFuncName meta) meta.ByteRange.Start byteCount
+
+        let internal rawRead (signal: Signal) (config: Signal.CANdy.Core.Config.Config) =
+            let (getFn, _) = accessorNames signal.ByteOrder
+            sprintf "%s(data, %d, %d)" getFn (chooseStartBit signal config) (int signal.Length)
+
+        /// slot is the message's index in the IR, i.e. its entry in sc_prof_stats (SC_PROF builds).
+        let generateMessageFiles (message: Message) (slot: int) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
             let messageNameLower = message.Name.ToLowerInvariant()
 
             let messageHPath =
@@ -678,6 +1140,121 @@ module Codegen =
                     |> List.map (fun s -> genEncodeForSignal s config.RangeCheck config)
                     |> String.concat "\n\n"
 
+            // codegen_style: table — descriptors in decode order (switch, base signals, then each branch)
+            // so every group is a contiguous slice that one sc_table_decode / sc_table_encode call walks.
+            let tableStyle = Utils.isTableStyle config
+
+            let tableGroups =
+                match switchOpt, branches with
+                | Some sw, (_ :: _) -> (None, sw :: baseSignals) :: (branches |> List.map (fun (k, sigs) -> Some k, sigs))
+                | _ -> [ None, message.Signals ]
+
+            let tableSignals = tableGroups |> List.collect snd
+
+            let tableScales =
+                tableSignals |> List.map (fun s -> Utils.tableScaleEntry s config) |> List.distinct
+
+            let signalTables =
+                if tableStyle && not tableSignals.IsEmpty then
+                    let descriptor (s: Signal) =
+                        let flags =
+                            [ if s.ByteOrder = ByteOrder.Big then "SC_SIG_BE"
+                              if s.IsSigned then "SC_SIG_SIGNED" ]
+
+                        sprintf
+                            "    { offsetof(%s_t, %s), %d, %d, %s, %d },"
+                            message.Name
+                            s.Name
+                            (Utils.chooseStartBit s config)
+                            (int s.Length)
+                            (if flags.IsEmpty then "0u" else String.concat " | " flags)
+                            (List.findIndex ((=) (Utils.tableScaleEntry s config)) tableScales)
+
+                    [ sprintf "static const sc_scale_t %s_scales[%d] = {" message.Name tableScales.Length
+                      yield! tableScales |> List.map (fun e -> sprintf "    %s," e)
+                      "};"
+                      ""
+                      sprintf "static const sc_signal_desc_t %s_signals[%d] = {" message.Name tableSignals.Length
+                      yield! tableSignals |> List.map descriptor
+                      "};" ]
+                    |> String.concat "\n"
+                else
+                    ""
+
+            // Start index and length of each group inside <MSG>_signals
+            let tableSlices =
+                tableGroups
+                |> List.mapFold (fun offset (key, sigs) -> (key, sigs, offset), offset + sigs.Length) 0
+                |> fst
+
+            let tableCall fn dataArg (sigs: Signal list) offset =
+                sprintf
+                    "if (!%s(&%s_signals[%d], %d, %s_scales, %s, msg)) { return false; }"
+                    fn
+                    message.Name
+                    offset
+                    sigs.Length
+                    message.Name
+                    dataArg
+
+            let tableValidUpdate (sigs: Signal list) =
+                if not isMux then
+                    []
+                elif useValidArray then
+                    sigs |> List.map (fun s -> sprintf "sc_valid_set(msg->valid, %s);" (validMacro s.Name))
+                else
+                    let bits =
+                        sigs
+                        |> List.map (fun s -> message.Signals |> List.findIndex (fun x -> x.Name = s.Name))
+                        |> List.fold (fun acc i -> acc ||| (1UL <<< i)) 0UL
+
+                    [ sprintf "msg->valid |= 0x%X%s;" bits (if validType = "uint64_t" then "ULL" else "u") ]
+
+            let signalDecodeC =
+                if not tableStyle || tableSignals.IsEmpty then
+                    signalDecodeC
+                else
+                    match switchOpt, tableSlices with
+                    | Some sw, (_, first, _) :: branchSlices when isMux ->
+                        let rawVar = sprintf "raw_%s" sw.Name
+
+                        [ if useValidArray then
+                              "    memset(msg->valid, 0, sizeof(msg->valid));"
+                          else
+                              sprintf "    msg->valid = %s;" initLiteral
+                          "    " + tableCall "sc_table_decode" "data" first 0
+                          yield! tableValidUpdate first |> List.map (fun l -> "    " + l)
+                          sprintf "    int64_t %s = sc_table_raw(&%s_signals[0], data);" rawVar message.Name
+                          sprintf "    msg->mux_active = (%s_mux_e)((int)%s);" message.Name rawVar
+                          for (key, sigs, offset) in branchSlices do
+                              sprintf "    if ((int)%s == %d) {" rawVar key.Value
+                              "        " + tableCall "sc_table_decode" "data" sigs offset
+                              yield! tableValidUpdate sigs |> List.map (fun l -> "        " + l)
+                              "    }" ]
+                        |> String.concat "\n"
+                    | _ -> "    " + tableCall "sc_table_decode" "data" message.Signals 0
+
+            let signalEncodeC =
+                if not tableStyle || tableSignals.IsEmpty then
+                    signalEncodeC
+                else
+                    match switchOpt, tableSlices with
+                    | Some sw, (_, first, _) :: branchSlices when isMux ->
+                        let rawVar = sprintf "raw_%s" sw.Name
+
+                        [ "    " + tableCall "sc_table_encode" "data" first 0
+                          sprintf
+                              "    int64_t %s = sc_table_to_raw(&%s_signals[0], %s_scales, msg);"
+                              rawVar
+                              message.Name
+                              message.Name
+                          for (key, sigs, offset) in branchSlices do
+                              sprintf "    if ((int)%s == %d) {" rawVar key.Value
+                              "        " + tableCall "sc_table_encode" "data" sigs offset
+                              "    }" ]
+                        |> String.concat "\n"
+                    | _ -> "    " + tableCall "sc_table_encode" "data" message.Signals 0
+
             let valueTableDeclarations =
                 let lines = System.Collections.Generic.List<string>()
 
@@ -843,55 +1420,65 @@ module Codegen =
                 else
                     ""
 
-            let crcDecodeCheck =
+            // E2E checks run on the raw payload ahead of signal extraction, comparing integers rather than
+            // the scaled struct fields, so corrupted frames are rejected before any decode work.
+            let hasE2e =
+                message.CrcCounterMode = Some CrcCounterMode.Validate
+                && (crcSignalOpt.IsSome || counterSignalOpt.IsSome)
+
+            let crcMismatchExpr =
                 match crcSignalOpt with
-                | Some crcSig when crcSig.CrcMeta.Value.Params.Width = 8 ->
+                | Some crcSig when hasE2e ->
                     let meta = crcSig.CrcMeta.Value
+                    Some(sprintf "%s != (uint%d_t)%s" (crcCall meta) meta.Params.Width (rawRead crcSig config))
+                | _ -> None
 
-                    let funcName =
-                        match meta.Algorithm with
-                        | CrcAlgorithmId.CRC8_SAE_J1850 -> "sc_crc8_sae_j1850"
-                        | CrcAlgorithmId.CRC8_8H2F -> "sc_crc8_8h2f"
-                        | CrcAlgorithmId.Custom name -> sprintf "sc_crc8_%s" (name.ToLowerInvariant().Replace("-", "_"))
-                        | _ -> "sc_crc8_unknown"
+            let crcDecodeCheck =
+                match crcMismatchExpr with
+                | Some expr -> sprintf "    if (%s) { SC_PROF_FAIL(%d, crc); return false; }" expr slot
+                | None -> ""
 
-                    let byteCount = meta.ByteRange.End - meta.ByteRange.Start + 1
+            let e2eChecks =
+                [ match crcMismatchExpr with
+                  | Some expr -> sprintf "    if (%s) { SC_PROF_FAIL(%d, crc); return SC_E2E_ERR_CRC; }" expr slot
+                  | None -> ()
+                  match counterSignalOpt with
+                  | Some counterSig ->
+                      sprintf
+                          "    if (state != NULL && !%s_counter_step(state, (uint8_t)%s)) { SC_PROF_FAIL(%d, counter); return SC_E2E_ERR_COUNTER; }"
+                          message.Name
+                          (rawRead counterSig config)
+                          slot
+                  | None -> () ]
+                |> String.concat "\n"
 
-                    match message.CrcCounterMode with
-                    | Some CrcCounterMode.Validate ->
-                        sprintf
-                            "    if (%s(&data[%d], %d) != (uint8_t)msg->%s) { return false; }"
-                            funcName
-                            meta.ByteRange.Start
-                            byteCount
-                            crcSig.Name
-                    | _ -> ""
-                | _ -> ""
+            let e2eDecodeDecl =
+                if hasE2e then
+                    sprintf
+                        "sc_e2e_status_t %s_decode_e2e(%s_t* msg, const uint8_t data[], uint8_t dlc%s);"
+                        message.Name
+                        message.Name
+                        (if hasCounter then
+                             sprintf ", %s_counter_state_t* state" message.Name
+                         else
+                             "")
+                else
+                    ""
 
             let crcEncodeInsert =
                 match crcSignalOpt with
-                | Some crcSig when crcSig.CrcMeta.Value.Params.Width = 8 ->
+                | Some crcSig ->
                     let meta = crcSig.CrcMeta.Value
-
-                    let funcName =
-                        match meta.Algorithm with
-                        | CrcAlgorithmId.CRC8_SAE_J1850 -> "sc_crc8_sae_j1850"
-                        | CrcAlgorithmId.CRC8_8H2F -> "sc_crc8_8h2f"
-                        | CrcAlgorithmId.Custom name -> sprintf "sc_crc8_%s" (name.ToLowerInvariant().Replace("-", "_"))
-                        | _ -> "sc_crc8_unknown"
-
-                    let byteCount = meta.ByteRange.End - meta.ByteRange.Start + 1
                     let startEff = chooseStartBit crcSig config
                     let (_, setFn) = accessorNames crcSig.ByteOrder
 
                     match message.CrcCounterMode with
                     | Some CrcCounterMode.Validate ->
                         sprintf
-                            "    uint8_t crc_val_%s = %s(&data[%d], %d);\n    %s(data, %d, %d, (uint64_t)crc_val_%s);"
+                            "    uint%d_t crc_val_%s = %s;\n    %s(data, %d, %d, (uint64_t)crc_val_%s);"
+                            meta.Params.Width
                             crcSig.Name
-                            funcName
-                            meta.ByteRange.Start
-                            byteCount
+                            (crcCall meta)
                             setFn
                             startEff
                             (int crcSig.Length)
@@ -899,22 +1486,145 @@ module Codegen =
                     | _ -> ""
                 | _ -> ""
 
+            let counterStepImpl =
+                match counterSignalOpt with
+                | Some counterSig when hasE2e ->
+                    sprintf
+                        "static bool %s_counter_step(%s_counter_state_t* state, uint8_t counter) {\n    if (!state->initialized) { state->last_counter = counter; state->initialized = true; return true; }\n    uint8_t expected = (uint8_t)((state->last_counter + %d) %% %d);\n    state->last_counter = counter;\n    return counter == expected;\n}"
+                        message.Name
+                        message.Name
+                        counterSig.CounterMeta.Value.Increment
+                        counterSig.CounterMeta.Value.Modulus
+                | _ -> ""
+
             let counterCheckFuncImpl =
                 match counterSignalOpt with
+                | Some counterSig when hasE2e ->
+                    sprintf
+                        "bool %s_check_counter(%s_counter_state_t* state, const %s_t* msg) {\n    return %s_counter_step(state, (uint8_t)msg->%s);\n}"
+                        message.Name
+                        message.Name
+                        message.Name
+                        message.Name
+                        counterSig.Name
                 | Some counterSig ->
                     let meta = counterSig.CounterMeta.Value
 
                     sprintf
-                        "bool %s_check_counter(%s_counter_state_t* state, const %s_t* msg) {\n    if (!state->initialized) { state->last_counter = (uint8_t)msg->%s; state->initialized = true; return true; }\n    uint8_t expected = (uint8_t)((state->last_counter + 1) %% %d);\n    state->last_counter = (uint8_t)msg->%s;\n    return (uint8_t)msg->%s == expected;\n}"
+                        "bool %s_check_counter(%s_counter_state_t* state, const %s_t* msg) {\n    if (!state->initialized) { state->last_counter = (uint8_t)msg->%s; state->initialized = true; return true; }\n    uint8_t expected = (uint8_t)((state->last_counter + %d) %% %d);\n    state->last_counter = (uint8_t)msg->%s;\n    return (uint8_t)msg->%s == expected;\n}"
                         message.Name
                         message.Name
                         message.Name
                         counterSig.Name
+                        meta.Increment
                         meta.Modulus
                         counterSig.Name
                         counterSig.Name
                 | None -> ""
 
+            // Linear CRCs satisfy crc(a) ^ crc(b) = crc(a ^ b) ^ crc(0), so the CRC change caused by a
+            // signal edit is the XOR of per-byte contributions of (old ^ new). Those contributions are
+            // tabulated here for each byte of the signal that lies inside the CRC byte range.
+            let crcPatchSignals =
+                match crcSignalOpt with
+                | Some crcSig when config.CrcPatch && message.CrcCounterMode = Some CrcCounterMode.Validate ->
+                    let meta = crcSig.CrcMeta.Value
+                    let msgLen = int message.Length
+                    let crcMask = Utils.signalPayloadMask crcSig config msgLen
+
+                    let crcInRange =
+                        [ meta.ByteRange.Start .. meta.ByteRange.End ]
+                        |> List.exists (fun i -> i < msgLen && crcMask.[i] <> 0uy)
+
+                    if crcInRange then
+                        []
+                    else
+                        message.Signals
+                        |> List.filter (fun s -> s.Name <> crcSig.Name)
+                        |> List.map (fun s -> crcSig, meta, s)
+                | _ -> []
+
+            let crcPatchImpl =
+                crcPatchSignals
+                |> List.map (fun (crcSig, meta, s) ->
+                    let msgLen = int message.Length
+                    let width = meta.Params.Width
+                    let ctype = sprintf "uint%d_t" width
+                    let rangeLen = meta.ByteRange.End - meta.ByteRange.Start + 1
+                    let mask = Utils.signalPayloadMask s config msgLen
+                    let (_, setFn) = accessorNames s.ByteOrder
+                    let (crcGet, crcSet) = accessorNames crcSig.ByteOrder
+                    let crcStart = chooseStartBit crcSig config
+
+                    let touched =
+                        [ meta.ByteRange.Start .. meta.ByteRange.End ]
+                        |> List.filter (fun i -> i < msgLen && mask.[i] <> 0uy)
+
+                    let writeBits =
+                        sprintf "    %s(data, %d, %d, raw);" setFn (chooseStartBit s config) (int s.Length)
+
+                    if List.isEmpty touched then
+                        sprintf "void %s_patch_%s(uint8_t data[], uint64_t raw) {\n%s\n}" message.Name s.Name writeBits
+                    else
+                        let crcOf (bytes: byte list) =
+                            Utils.crcFinalize meta.Params (Utils.crcRegisterAfter meta.Params bytes)
+
+                        let zeroCrc = crcOf (List.replicate rangeLen 0uy)
+
+                        let tables =
+                            touched
+                            |> List.map (fun byteIdx ->
+                                let pos = byteIdx - meta.ByteRange.Start
+
+                                Array.init 256 (fun v ->
+                                    let bytes =
+                                        List.init rangeLen (fun i -> if i = pos then byte v else 0uy)
+
+                                    crcOf bytes ^^^ zeroCrc))
+                            |> List.toArray
+
+                        let tableName = sprintf "%s_%s_crc_delta" message.Name s.Name
+
+                        let saves =
+                            touched
+                            |> List.map (fun i -> sprintf "    uint8_t old%d = data[%d];" i i)
+                            |> String.concat "\n"
+
+                        let deltas =
+                            touched
+                            |> List.mapi (fun k i -> sprintf "%s[%d][old%d ^ data[%d]]" tableName k i i)
+                            |> String.concat " ^\n           "
+
+                        sprintf
+                            "static const %s %s[%d][256] = %s;\nvoid %s_patch_%s(uint8_t data[], uint64_t raw) {\n%s\n%s\n    %s crc = (%s)%s(data, %d, %d);\n    crc ^= %s;\n    %s(data, %d, %d, (uint64_t)crc);\n}"
+                            ctype
+                            tableName
+                            tables.Length
+                            (Utils.formatCrcTables (width / 4) tables)
+                            message.Name
+                            s.Name
+                            saves
+                            writeBits
+                            ctype
+                            ctype
+                            crcGet
+                            crcStart
+                            (int crcSig.Length)
+                            deltas
+                            crcSet
+                            crcStart
+                            (int crcSig.Length))
+                |> String.concat "\n\n"
+
+            let crcPatchDecls =
+                match crcPatchSignals with
+                | [] -> ""
+                | signals ->
+                    "/* Rewrite one signal's raw bits in an encoded frame and update its CRC incrementally */\n"
+                    + (signals
+                       |> List.map (fun (_, _, s) -> sprintf "void %s_patch_%s(uint8_t data[], uint64_t raw);" message.Name s.Name)
+                       |> String.concat "\n")
+
             let headerContent =
                 let model: (string * obj) list =
                     [ "banner", box banner
@@ -923,11 +1633,14 @@ module Codegen =
                       "struct_extra_fields", box muxStructFields
                       "signal_declarations_h", box signalDeclarationsH
                       "message_name", box message.Name
-                      "needs_utils_include", box useValidArray
+                      "needs_utils_include", box (useValidArray || hasE2e)
                       "utils_header_name", box (Utils.utilsHeaderName config)
                       "has_counter", box hasCounter
                       "counter_state_type_decl", box counterStateTypeDecl
-                      "counter_check_func_decl", box counterCheckFuncDecl ]
+                      "counter_check_func_decl", box counterCheckFuncDecl
+                      "has_e2e", box hasE2e
+                      "e2e_decode_decl", box e2eDecodeDecl
+                      "crc_patch_decls", box crcPatchDecls ]
 
                 Templates.renderOrRaise "message.h.scriban" model
 
@@ -937,14 +1650,20 @@ module Codegen =
                       "message_header_name", box (sprintf "%s.h" messageNameLower)
                       "utils_header_name", box (Utils.utilsHeaderName config)
                       "value_table_definitions", box valueTableDefinitions
+                      "signal_tables", box signalTables
                       "message_name", box message.Name
                       "message_length", box (int message.Length)
+                      "prof_slot", box slot
                       "signal_decode_c", box signalDecodeC
                       "signal_encode_c", box signalEncodeC
                       "crc_decode_check", box crcDecodeCheck
                       "crc_encode_insert", box crcEncodeInsert
                       "has_counter", box hasCounter
-                      "counter_check_func_impl", box counterCheckFuncImpl ]
+                      "counter_check_func_impl", box counterCheckFuncImpl
+                      "has_e2e", box hasE2e
+                      "counter_step_impl", box counterStepImpl
+                      "e2e_checks", box e2eChecks
+                      "crc_patch_impl", box crcPatchImpl ]
 
                 Templates.renderOrRaise "message.c.scriban" model
 
@@ -990,7 +1709,9 @@ module Codegen =
                     [ "banner", box banner
                       "header_guard", box guard
                       "registry_declaration",
-                      box "bool decode_message(uint32_t id, const uint8_t data[], uint8_t dlc, void* msg);" ]
+                      box "bool decode_message(uint32_t id, const uint8_t data[], uint8_t dlc, void* msg);"
+                      "utils_header_name", box (Utils.utilsHeaderName config)
+                      "has_cache", box config.RegistryCache ]
 
                 Templates.renderOrRaise "registry.h.scriban" model
 
@@ -1014,7 +1735,7 @@ module Codegen =
                         |> String.concat "\n"
 
                     sprintf
-                        "bool decode_message(uint32_t id, const uint8_t data[], uint8_t dlc, void* msg) {\n    switch (id) {\n%s\n        default: return false;\n    }\n}"
+                        "bool decode_message(uint32_t id, const uint8_t data[], uint8_t dlc, void* msg) {\n    switch (id) {\n%s\n        default: SC_PROF_UNKNOWN_ID(); return false;\n    }\n}"
                         cases
                 else
                     let sorted = ir.Messages |> List.sortBy (fun m -> m.Id)
@@ -1046,6 +1767,7 @@ module Codegen =
                           "        }"
                           "        if (decoders[mid].id < id) low = mid + 1; else high = mid - 1;"
                           "    }"
+                          "    SC_PROF_UNKNOWN_ID();"
                           "    return false;"
                           "}"
                           "" ]
@@ -1053,95 +1775,2367 @@ module Codegen =
 
                     table + search
 
+            // sc_prof_stats slots follow the IR order, matching the slot each message source was generated with.
+            let profEntries =
+                ir.Messages
+                |> List.map (fun m -> sprintf "    { .id = %du, .name = \"%s\" }" (int m.Id) m.Name)
+                |> String.concat ",\n"
+
+            // Per-message cache slots for decode_message_cached (registry_cache: true).
+            // Entries are sorted by ID so the lookup mirrors the dispatch strategy.
+            let cacheTables =
+                if not config.RegistryCache then
+                    ""
+                else
+                    let sorted = ir.Messages |> List.sortBy (fun m -> m.Id)
+
+                    let storage =
+                        sorted
+                        |> List.map (fun m ->
+                            sprintf
+                                "static %s_t cache_msg_%s;\nstatic uint8_t cache_payload_%s[%d];"
+                                m.Name
+                                m.Name
+                                m.Name
+                                (max 1 (int m.Length)))
+                        |> String.concat "\n"
+
+                    let entries =
+                        sorted
+                        |> List.map (fun m ->
+                            sprintf
+                                "    { %du, (cache_decode_func_t)%s_decode, %du, sizeof(%s_t), cache_payload_%s, &cache_msg_%s, false, { 0u, 0u } }"
+                                (int m.Id)
+                                m.Name
+                                (int m.Length)
+                                m.Name
+                                m.Name
+                                m.Name)
+                        |> String.concat ",\n"
+
+                    let index =
+                        if config.Dispatch.ToLowerInvariant() = "direct_map" then
+                            let cases =
+                                sorted
+                                |> List.mapi (fun i m -> sprintf "        case %du: return %d;" (int m.Id) i)
+                                |> String.concat "\n"
+
+                            sprintf
+                                "static int cache_index(uint32_t id) {\n    switch (id) {\n%s\n        default: return -1;\n    }\n}"
+                                cases
+                        else
+                            [ "static int cache_index(uint32_t id) {"
+                              "    int low = 0;"
+                              "    int high = (int)(sizeof(cache_entries) / sizeof(cache_entries[0])) - 1;"
+                              "    while (low <= high) {"
+                              "        int mid = low + (high - low) / 2;"
+                              "        if (cache_entries[mid].id == id) return mid;"
+                              "        if (cache_entries[mid].id < id) low = mid + 1; else high = mid - 1;"
+                              "    }"
+                              "    return -1;"
+                              "}" ]
+                            |> String.concat "\n"
+
+                    [ storage
+                      ""
+                      "static decode_cache_entry_t cache_entries[] = {"
+                      entries
+                      "};"
+                      ""
+                      index ]
+                    |> String.concat "\n"
+
             let finalC =
                 let model: (string * obj) list =
                     [ "banner", box banner
                       "registry_header_name", box (sprintf "%sregistry.h" config.FilePrefix)
+                      "utils_header_name", box (Utils.utilsHeaderName config)
                       "message_includes", box includes
-                      "registry_body", box body ]
+                      "registry_body", box (body.TrimEnd('\n'))
+                      "prof_entries", box profEntries
+                      "has_cache", box config.RegistryCache
+                      "cache_tables", box cacheTables ]
 
                 Templates.renderOrRaise "registry.c.scriban" model
 
             File.WriteAllText(registryCPath, finalC)
             registryHPath, registryCPath
 
-    // Compatibility shims for legacy includes (utils.h, registry.h)
-    let private shimHeader (name: string) (target: string) =
-        let guard = (name.Replace('.', '_') + "_SHIM").ToUpperInvariant()
+    module Subscribe =
+        let subscribeHeaderName (config: Signal.CANdy.Core.Config.Config) = sprintf "%ssubscribe.h" config.FilePrefix
+
+        let subscribeSourceName (config: Signal.CANdy.Core.Config.Config) = sprintf "%ssubscribe.c" config.FilePrefix
+
+        let private signalIndexMacro (message: Message) (signal: Signal) =
+            sprintf "%s_SIG_%s" (message.Name.ToUpperInvariant()) (signal.Name.ToUpperInvariant())
+
+        // Payload bytes as little-endian 64-bit words.
+        let private toWords (len: int) (bytes: byte[]) =
+            [ for w in 0 .. (len + 7) / 8 - 1 ->
+                  [ 0..7 ]
+                  |> List.fold
+                      (fun acc j ->
+                          let i = w * 8 + j
+                          if i < len then acc ||| (uint64 bytes.[i] <<< (8 * j)) else acc)
+                      0UL ]
+
+        // Per-signal payload masks: each signal's own bits only, so a switch change alone does not
+        // mark a branch value as changed.
+        let private maskWords (message: Message) (config: Signal.CANdy.Core.Config.Config) (signal: Signal) =
+            let len = int message.Length
+            Utils.signalPayloadMask signal config len |> toWords len
+
+        // Multiplexed branch signals, with the switch footprint and, per signal, the switch bits that
+        // select its branch. Whether a branch signal is live is checked on both the previous and the
+        // incoming payload.
+        let private branchTables (message: Message) (config: Signal.CANdy.Core.Config.Config) =
+            let len = int message.Length
+
+            match Message.partitionMultiplex message with
+            | Some sw, _, _ :: _ ->
+                let switchMask = Utils.signalPayloadMask sw config len |> toWords len
+
+                let selectors =
+                    message.Signals
+                    |> List.map (fun s ->
+                        match s.MultiplexerIndicator, s.MultiplexerSwitchValue with
+                        | Some "m", Some v -> Some(Utils.signalPayloadPattern sw config len (uint64 v) |> toWords len)
+                        | _ -> None)
 
-        "#ifndef "
-        + guard
-        + "\n#define "
-        + guard
-        + "\n\n"
-        + "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n"
-        + "#include \""
-        + target
-        + "\"\n\n"
-        + "#ifdef __cplusplus\n}\n#endif\n\n"
-        + "#endif // "
-        + guard
+                Some(switchMask, selectors)
+            | _ -> None
 
-    // Main entry: generate code and return file lists
-    let generate
-        (ir: Ir)
-        (outputPath: string)
-        (config: Signal.CANdy.Core.Config.Config)
-        : Result<GeneratedFiles, CodeGenError> =
-        try
-            // Ensure output directories
-            Directory.CreateDirectory(Path.Combine(outputPath, "include")) |> ignore
+        // Messages whose decode can reject a frame (range checks, CRC validation) or whose signal
+        // validity depends on the multiplexer go through the full <MSG>_decode; everything else
+        // decodes only the changed signals.
+        let private usesFullDecode (message: Message) (config: Signal.CANdy.Core.Config.Config) =
+            let switchOpt, _, branches = Message.partitionMultiplex message
 
-            Directory.CreateDirectory(Path.Combine(outputPath, "src")) |> ignore
+            let isMux =
+                match switchOpt, branches with
+                | Some _, _ :: _ -> true
+                | _ -> false
 
-            let overflowGuard =
-                ir.Messages
-                |> List.tryFind (fun msg ->
-                    let hasMuxSwitch =
-                        msg.Signals |> List.exists (fun s -> s.MultiplexerIndicator = Some "M")
+            let validatesCrc =
+                message.CrcCounterMode = Some CrcCounterMode.Validate
+                && message.Signals |> List.exists (fun s -> s.CrcMeta.IsSome)
 
-                    let hasMuxBranches =
-                        msg.Signals
-                        |> List.exists (fun s -> s.MultiplexerIndicator = Some "m" && s.MultiplexerSwitchValue.IsSome)
+            isMux || validatesCrc || config.RangeCheck
 
-                    hasMuxSwitch && hasMuxBranches && msg.Signals.Length > 1024)
+        let private slotDefinitions (message: Message) (config: Signal.CANdy.Core.Config.Config) =
+            let name = message.Name
+            let len = int message.Length
+            let words = (len + 7) / 8
 
-            match overflowGuard with
-            | Some msg ->
-                Error(
-                    CodeGenError.UnsupportedFeature(
-                        sprintf
-                            "Message '%s' has %d signals (>1024); valid bitmask cannot support more than 1024 signals."
-                            msg.Name
-                            msg.Signals.Length
-                    )
-                )
-            | None ->
-                let ir = Signal.CANdy.Core.Dbc.applyConfigMetadata (Some config) ir
+            let masks =
+                if message.Signals.IsEmpty then
+                    ""
+                else
+                    let rows =
+                        message.Signals
+                        |> List.map (fun s ->
+                            let words =
+                                maskWords message config s
+                                |> List.map (sprintf "0x%016XULL")
+                                |> String.concat ", "
+
+                            sprintf "    %s, /* %s */" words s.Name)
+                        |> String.concat "\n"
 
-                let hasCrcValidateMode =
-                    match config.CrcCounter with
-                    | Some crcCfg when crcCfg.Mode = "validate" -> true
-                    | _ -> false
+                    sprintf "static const uint64_t sub_mask_%s[] = {\n%s\n};\n" name rows
 
-                let crcCounterGuard =
-                    match config.CrcCounter with
-                    | Some crcCfg when crcCfg.Mode = "fail_fast" ->
-                        if crcCfg.Messages.IsEmpty then
-                            None
-                        else
-                            let firstMsg = crcCfg.Messages |> Map.toList |> List.head |> fst
-                            Some(firstMsg, "CRC/counter", None)
-                    | Some _ -> None
-                    | None ->
-                        if config.CrcCounterCheck then
-                            ir.Messages
-                            |> List.tryPick (fun msg ->
-                                msg.Signals
-                                |> List.tryFind (fun s -> s.IsCrc || s.IsCounter)
-                                |> Option.map (fun s ->
-                                    (msg.Name,
-                                     (if s.IsCrc then "CRC"
+            let branches = branchTables message config
+
+            let branchDefs =
+                match branches with
+                | None -> ""
+                | Some(switchMask, selectors) ->
+                    let hex ws =
+                        ws |> List.map (sprintf "0x%016XULL") |> String.concat ", "
+
+                    let flags =
+                        selectors
+                        |> List.map (fun sel -> if sel.IsSome then "1u" else "0u")
+                        |> String.concat ", "
+
+                    let rows =
+                        List.zip message.Signals selectors
+                        |> List.map (fun (s, sel) ->
+                            let ws = sel |> Option.defaultValue (List.replicate words 0UL)
+                            sprintf "    %s, /* %s */" (hex ws) s.Name)
+                        |> String.concat "\n"
+
+                    [ sprintf "static const uint64_t sub_switch_%s[] = { %s };" name (hex switchMask)
+                      sprintf "static const uint8_t sub_is_branch_%s[] = { %s };" name flags
+                      sprintf "static const uint64_t sub_branch_%s[] = {\n%s\n};\n" name rows ]
+                    |> String.concat "\n"
+
+            let decodeFn =
+                if usesFullDecode message config then
+                    [ sprintf
+                          "static bool sub_decode_%s(const uint8_t data[], uint8_t dlc, const uint16_t changed[], uint16_t n_changed) {"
+                          name
+                      sprintf "    %s_t tmp;" name
+                      "    (void)changed;"
+                      "    (void)n_changed;"
+                      sprintf "    if (!%s_decode(&tmp, data, dlc)) { return false; }" name
+                      sprintf "    sub_msg_%s = tmp;" name
+                      "    return true;"
+                      "}" ]
+                    |> String.concat "\n"
+                else
+                    let cases =
+                        message.Signals
+                        |> List.map (fun s ->
+                            let body =
+                                Message.genDecodeForSignal s false config
+                                |> fun c -> c.Split('\n')
+                                |> Array.map (fun line -> "        " + line)
+                                |> String.concat "\n"
+
+                            [ sprintf "        case %s: {" (signalIndexMacro message s)
+                              body
+                              "            break;"
+                              "        }" ]
+                            |> String.concat "\n")
+                        |> String.concat "\n"
+
+                    [ sprintf
+                          "static bool sub_decode_%s(const uint8_t data[], uint8_t dlc, const uint16_t changed[], uint16_t n_changed) {"
+                          name
+                      sprintf "    %s_t* msg = &sub_msg_%s;" name name
+                      "    (void)dlc;"
+                      "    for (uint16_t i = 0; i < n_changed; ++i) {"
+                      "        switch (changed[i]) {"
+                      (if cases = "" then null else cases)
+                      "        default: break;"
+                      "        }"
+                      "    }"
+                      "    return true;"
+                      "}" ]
+                    |> List.filter (fun l -> not (isNull l))
+                    |> String.concat "\n"
+
+            [ sprintf "static %s_t sub_msg_%s;" name name
+              sprintf "static uint8_t sub_last_%s[%d];" name (max 1 len)
+              masks
+              branchDefs
+              decodeFn ]
+            |> List.filter (fun b -> b <> "")
+            |> String.concat "\n"
+            |> fun body ->
+                body,
+                let branchRefs =
+                    match branches with
+                    | Some _ -> sprintf "sub_switch_%s, sub_is_branch_%s, sub_branch_%s" name name name
+                    | None -> "NULL, NULL, NULL"
+
+                sprintf
+                    "    { %du, %du, %du, %du, %s, %s, sub_last_%s, &sub_msg_%s, sub_decode_%s, false }"
+                    (int message.Id)
+                    len
+                    words
+                    message.Signals.Length
+                    (if message.Signals.IsEmpty then "NULL" else sprintf "sub_mask_%s" name)
+                    branchRefs
+                    name
+                    name
+                    name
+
+        let generateSubscribeFiles (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let hName = subscribeHeaderName config
+            let hPath = Path.Combine(outputPath, "include", hName)
+            let cPath = Path.Combine(outputPath, "src", subscribeSourceName config)
+
+            let guard =
+                (config.FilePrefix + "subscribe_h").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let sorted = ir.Messages |> List.sortBy (fun m -> m.Id)
+
+            let indexDefines =
+                sorted
+                |> List.map (fun m ->
+                    let perSignal =
+                        m.Signals
+                        |> List.mapi (fun i s -> sprintf "#define %s %du" (signalIndexMacro m s) i)
+
+                    perSignal
+                    @ [ sprintf "#define %s_SIG_COUNT %du" (m.Name.ToUpperInvariant()) m.Signals.Length ]
+                    |> String.concat "\n")
+                |> String.concat "\n\n"
+
+            let headerContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_guard", box guard
+                      "signal_index_defines", box indexDefines ]
+
+                Templates.renderOrRaise "subscribe.h.scriban" model
+
+            let slots = sorted |> List.map (fun m -> slotDefinitions m config)
+
+            let maxSignals =
+                sorted |> List.map (fun m -> m.Signals.Length) |> List.fold max 1
+
+            let maxWords =
+                sorted |> List.map (fun m -> (int m.Length + 7) / 8) |> List.fold max 1
+
+            let index =
+                if config.Dispatch.ToLowerInvariant() = "direct_map" then
+                    let cases =
+                        sorted
+                        |> List.mapi (fun i m -> sprintf "        case %du: return %d;" (int m.Id) i)
+                        |> String.concat "\n"
+
+                    sprintf
+                        "static int sub_index(uint32_t id) {\n    switch (id) {\n%s\n        default: return -1;\n    }\n}"
+                        cases
+                else
+                    [ "static int sub_index(uint32_t id) {"
+                      "    int low = 0;"
+                      "    int high = (int)(sizeof(sub_slots) / sizeof(sub_slots[0])) - 1;"
+                      "    while (low <= high) {"
+                      "        int mid = low + (high - low) / 2;"
+                      "        if (sub_slots[mid].id == id) return mid;"
+                      "        if (sub_slots[mid].id < id) low = mid + 1; else high = mid - 1;"
+                      "    }"
+                      "    return -1;"
+                      "}" ]
+                    |> String.concat "\n"
+
+            let slotTables =
+                [ sprintf "#define SUB_MAX_SIGNALS %d" maxSignals
+                  sprintf "#define SUB_MAX_WORDS %d" maxWords
+                  ""
+                  slots |> List.map fst |> String.concat "\n\n"
+                  ""
+                  "static sub_slot_t sub_slots[] = {"
+                  slots |> List.map snd |> String.concat ",\n"
+                  "};"
+                  ""
+                  index ]
+                |> String.concat "\n"
+
+            let includes =
+                ir.Messages
+                |> List.map (fun m -> sprintf "#include \"%s.h\"" (m.Name.ToLowerInvariant()))
+                |> String.concat "\n"
+
+            let sourceContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "subscribe_header_name", box hName
+                      "utils_header_name", box (Utils.utilsHeaderName config)
+                      "message_includes", box includes
+                      "slot_tables", box slotTables ]
+
+                Templates.renderOrRaise "subscribe.c.scriban" model
+
+            File.WriteAllText(hPath, headerContent)
+            File.WriteAllText(cPath, sourceContent)
+            hPath, cPath
+
+    module TxScheduler =
+        let schedulerHeaderName (config: Signal.CANdy.Core.Config.Config) = sprintf "%stx_scheduler.h" config.FilePrefix
+
+        let schedulerSourceName (config: Signal.CANdy.Core.Config.Config) = sprintf "%stx_scheduler.c" config.FilePrefix
+
+        let rec private gcd (a: int) (b: int) = if b = 0 then a else gcd b (a % b)
+
+        let generateSchedulerFiles (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let hName = schedulerHeaderName config
+            let hPath = Path.Combine(outputPath, "include", hName)
+            let cPath = Path.Combine(outputPath, "src", schedulerSourceName config)
+
+            let guard =
+                (config.FilePrefix + "tx_scheduler_h").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let periodic =
+                ir.Messages
+                |> List.choose (fun m -> m.CycleTimeMs |> Option.map (fun c -> m, c))
+                |> List.sortBy (fun (m, _) -> m.Id)
+
+            // Coarsest tick that still lands every period and start delay exactly.
+            let tickMs =
+                periodic
+                |> List.collect (fun (m, c) -> c :: (m.StartDelayMs |> Option.toList))
+                |> List.fold gcd 0
+                |> max 1
+
+            let maxPeriodTicks =
+                periodic |> List.map (fun (_, c) -> c / tickMs) |> List.fold max 1
+
+            // Power of two so the slot is a mask; longer periods wrap and are told apart by due tick.
+            let wheelSlots =
+                Seq.initInfinite (fun i -> 1 <<< i)
+                |> Seq.find (fun n -> n >= maxPeriodTicks || n >= 256)
+                |> max 8
+
+            let maxDlc = periodic |> List.map (fun (m, _) -> int m.Length) |> List.fold max 1
+
+            let headerContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_guard", box guard
+                      "tick_ms", box tickMs
+                      "message_count", box periodic.Length
+                      "max_dlc", box maxDlc ]
+
+                Templates.renderOrRaise "tx_scheduler.h.scriban" model
+
+            let entries =
+                periodic
+                |> List.map (fun (m, c) ->
+                    sprintf
+                        "    { %du, (tx_encode_func_t)%s_encode, %du, %du, NULL, 0u, -1, true }, /* %d ms */"
+                        (int m.Id)
+                        m.Name
+                        (c / tickMs)
+                        ((m.StartDelayMs |> Option.defaultValue 0) / tickMs)
+                        c)
+                |> String.concat "\n"
+
+            let entryTable =
+                [ sprintf "#define TX_WHEEL_SLOTS %du" wheelSlots
+                  ""
+                  sprintf "static tx_entry_t tx_entries[%d] = {" (max 1 periodic.Length)
+                  (if periodic.IsEmpty then "    { 0u, NULL, 1u, 0u, NULL, 0u, -1, false }" else entries)
+                  "};" ]
+                |> String.concat "\n"
+
+            let includes =
+                periodic
+                |> List.map (fun (m, _) -> sprintf "#include \"%s.h\"" (m.Name.ToLowerInvariant()))
+                |> String.concat "\n"
+
+            let sourceContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "scheduler_header_name", box hName
+                      "message_includes", box includes
+                      "entry_table", box entryTable ]
+
+                Templates.renderOrRaise "tx_scheduler.c.scriban" model
+
+            File.WriteAllText(hPath, headerContent)
+            File.WriteAllText(cPath, sourceContent)
+            hPath, cPath
+
+    module RxMonitor =
+        let monitorHeaderName (config: Signal.CANdy.Core.Config.Config) = sprintf "%srx_monitor.h" config.FilePrefix
+
+        let monitorSourceName (config: Signal.CANdy.Core.Config.Config) = sprintf "%srx_monitor.c" config.FilePrefix
+
+        let rec private gcd (a: int) (b: int) = if b = 0 then a else gcd b (a % b)
+
+        let generateMonitorFiles (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let hName = monitorHeaderName config
+            let hPath = Path.Combine(outputPath, "include", hName)
+            let cPath = Path.Combine(outputPath, "src", monitorSourceName config)
+
+            let guard =
+                (config.FilePrefix + "rx_monitor_h").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            // Same ID order as the registry's binary-search table, restricted to cyclic messages.
+            let monitored =
+                ir.Messages
+                |> List.choose (fun m -> m.CycleTimeMs |> Option.map (fun c -> m, c * config.RxTimeoutFactor))
+                |> List.sortBy (fun (m, _) -> m.Id)
+
+            let tickMs = monitored |> List.map snd |> List.fold gcd 0 |> max 1
+
+            let maxTimeoutTicks =
+                monitored |> List.map (fun (_, t) -> t / tickMs) |> List.fold max 1
+
+            let wheelSlots =
+                Seq.initInfinite (fun i -> 1 <<< i)
+                |> Seq.find (fun n -> n >= maxTimeoutTicks || n >= 256)
+                |> max 8
+
+            let bitDefines =
+                monitored
+                |> List.mapi (fun i (m, _) -> sprintf "#define RX_MONITOR_BIT_%s %d" (m.Name.ToUpperInvariant()) i)
+                |> String.concat "\n"
+
+            let headerContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_guard", box guard
+                      "timeout_factor", box config.RxTimeoutFactor
+                      "tick_ms", box tickMs
+                      "message_count", box monitored.Length
+                      "bitmap_words", box (max 1 ((monitored.Length + 31) / 32))
+                      "bit_defines", box bitDefines ]
+
+                Templates.renderOrRaise "rx_monitor.h.scriban" model
+
+            let entries =
+                monitored
+                |> List.map (fun (m, t) ->
+                    sprintf "    { %du, %du, 0u, -1, -1, false, true }, /* %s: %d ms */" (int m.Id) (t / tickMs) m.Name t)
+                |> String.concat "\n"
+
+            let index =
+                if config.Dispatch.ToLowerInvariant() = "direct_map" then
+                    let cases =
+                        monitored
+                        |> List.mapi (fun i (m, _) -> sprintf "        case %du: return %d;" (int m.Id) i)
+                        |> String.concat "\n"
+
+                    [ "static int rx_index(uint32_t id) {"
+                      "    switch (id) {"
+                      (if cases = "" then null else cases)
+                      "        default: return -1;"
+                      "    }"
+                      "}" ]
+                    |> List.filter (fun l -> not (isNull l))
+                    |> String.concat "\n"
+                else
+                    [ "static int rx_index(uint32_t id) {"
+                      "    int low = 0;"
+                      "    int high = RX_MONITOR_MESSAGE_COUNT - 1;"
+                      "    while (low <= high) {"
+                      "        int mid = low + (high - low) / 2;"
+                      "        if (rx_entries[mid].id == id) return mid;"
+                      "        if (rx_entries[mid].id < id) low = mid + 1; else high = mid - 1;"
+                      "    }"
+                      "    return -1;"
+                      "}" ]
+                    |> String.concat "\n"
+
+            let entryTable =
+                [ sprintf "#define RX_WHEEL_SLOTS %du" wheelSlots
+                  ""
+                  sprintf "static rx_entry_t rx_entries[%d] = {" (max 1 monitored.Length)
+                  (if monitored.IsEmpty then "    { 0u, 1u, 0u, -1, -1, false, false }" else entries)
+                  "};"
+                  ""
+                  index ]
+                |> String.concat "\n"
+
+            let sourceContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "monitor_header_name", box hName
+                      "entry_table", box entryTable ]
+
+                Templates.renderOrRaise "rx_monitor.c.scriban" model
+
+            File.WriteAllText(hPath, headerContent)
+            File.WriteAllText(cPath, sourceContent)
+            hPath, cPath
+
+    module E2eSupervisor =
+        let supervisorHeaderName (config: Signal.CANdy.Core.Config.Config) =
+            sprintf "%se2e_supervisor.h" config.FilePrefix
+
+        let supervisorSourceName (config: Signal.CANdy.Core.Config.Config) =
+            sprintf "%se2e_supervisor.c" config.FilePrefix
+
+        // Validate-mode messages with a counter, in registry ID order; the CRC signal is optional.
+        let private supervised (ir: Ir) =
+            ir.Messages
+            |> List.filter (fun m -> m.CrcCounterMode = Some CrcCounterMode.Validate)
+            |> List.choose (fun m ->
+                m.Signals
+                |> List.tryFind (fun s -> s.CounterMeta.IsSome)
+                |> Option.map (fun counterSig -> m, counterSig, m.Signals |> List.tryFind (fun s -> s.CrcMeta.IsSome)))
+            |> List.sortBy (fun (m, _, _) -> m.Id)
+
+        let private readFunction (message: Message) (counterSig: Signal) (crcSig: Signal option) config =
+            [ sprintf
+                  "static e2e_sup_status_t e2e_read_%s(const uint8_t data[], uint8_t dlc, e2e_sup_counter_t* counter) {"
+                  message.Name
+              sprintf "    if (dlc < %d) { return E2E_SUP_ERR_DLC; }" (int message.Length)
+              match crcSig with
+              | Some crcSig ->
+                  let meta = crcSig.CrcMeta.Value
+
+                  sprintf
+                      "    if (%s != (uint%d_t)%s) { return E2E_SUP_WRONG_CRC; }"
+                      (Message.crcCall meta)
+                      meta.Params.Width
+                      (Message.rawRead crcSig config)
+              | None -> ()
+              sprintf "    *counter = (e2e_sup_counter_t)%s;" (Message.rawRead counterSig config)
+              "    return E2E_SUP_OK;"
+              "}" ]
+            |> String.concat "\n"
+
+        let generateSupervisorFiles (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let hName = supervisorHeaderName config
+            let hPath = Path.Combine(outputPath, "include", hName)
+            let cPath = Path.Combine(outputPath, "src", supervisorSourceName config)
+
+            let guard =
+                (config.FilePrefix + "e2e_supervisor_h").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let messages = supervised ir
+
+            let indexDefines =
+                messages
+                |> List.mapi (fun i (m, _, _) -> sprintf "#define E2E_SUP_INDEX_%s %d" (m.Name.ToUpperInvariant()) i)
+                |> String.concat "\n"
+
+            let headerContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_guard", box guard
+                      "message_count", box messages.Length
+                      "index_defines", box indexDefines ]
+
+                Templates.renderOrRaise "e2e_supervisor.h.scriban" model
+
+            // Counters wider than 8 bits only widen the state array when some modulus needs it.
+            let counterType =
+                let maxModulus =
+                    messages |> List.map (fun (_, c, _) -> c.CounterMeta.Value.Modulus) |> List.fold max 0
+
+                if maxModulus > 65536 then "uint32_t"
+                elif maxModulus > 256 then "uint16_t"
+                else "uint8_t"
+
+            let readFunctions =
+                messages
+                |> List.map (fun (m, c, crc) -> readFunction m c crc config)
+                |> String.concat "\n\n"
+
+            let entries =
+                messages
+                |> List.map (fun (m, c, _) ->
+                    let meta = c.CounterMeta.Value
+
+                    sprintf
+                        "    { %du, %du, %du, %du, e2e_read_%s },"
+                        (int m.Id)
+                        meta.Modulus
+                        (max 1 meta.Increment)
+                        meta.MaxDelta
+                        m.Name)
+                |> String.concat "\n"
+
+            let index =
+                if config.Dispatch.ToLowerInvariant() = "direct_map" then
+                    let cases =
+                        messages
+                        |> List.mapi (fun i (m, _, _) -> sprintf "        case %du: return %d;" (int m.Id) i)
+                        |> String.concat "\n"
+
+                    [ "static int e2e_index(uint32_t id) {"
+                      "    switch (id) {"
+                      (if cases = "" then null else cases)
+                      "        default: return -1;"
+                      "    }"
+                      "}" ]
+                    |> List.filter (fun l -> not (isNull l))
+                    |> String.concat "\n"
+                else
+                    [ "static int e2e_index(uint32_t id) {"
+                      "    int low = 0;"
+                      "    int high = E2E_SUP_MESSAGE_COUNT - 1;"
+                      "    while (low <= high) {"
+                      "        int mid = low + (high - low) / 2;"
+                      "        if (e2e_entries[mid].id == id) return mid;"
+                      "        if (e2e_entries[mid].id < id) low = mid + 1; else high = mid - 1;"
+                      "    }"
+                      "    return -1;"
+                      "}" ]
+                    |> String.concat "\n"
+
+            let entryTable =
+                [ sprintf "#define E2E_SUP_ARRAY_LEN %d" (max 1 messages.Length)
+                  ""
+                  if not messages.IsEmpty then
+                      readFunctions
+                      ""
+                  "static const e2e_sup_entry_t e2e_entries[E2E_SUP_ARRAY_LEN] = {"
+                  (if messages.IsEmpty then "    { 0u, 1u, 1u, 1u, NULL }" else entries)
+                  "};"
+                  ""
+                  index ]
+                |> String.concat "\n"
+
+            let sourceContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "utils_header_name", box (Utils.utilsHeaderName config)
+                      "supervisor_header_name", box hName
+                      "counter_type", box counterType
+                      "entry_table", box entryTable ]
+
+                Templates.renderOrRaise "e2e_supervisor.c.scriban" model
+
+            File.WriteAllText(hPath, headerContent)
+            File.WriteAllText(cPath, sourceContent)
+            hPath, cPath
+
+    module CppHeader =
+        let cppHeaderName (config: Signal.CANdy.Core.Config.Config) = sprintf "%ssignals.hpp" config.FilePrefix
+
+        // Nested type names may not repeat the enclosing struct or its static members.
+        let private signalTypeName (message: Message) (signal: Signal) =
+            if List.contains signal.Name [ message.Name; "id"; "is_extended"; "length"; "name"; "signals" ] then
+                signal.Name + "_"
+            else
+                signal.Name
+
+        let private signalStruct (message: Message) (signal: Signal) (config: Signal.CANdy.Core.Config.Config) =
+            let mask = Utils.signalPayloadMask signal config (int message.Length)
+
+            let minBytes =
+                mask
+                |> Array.tryFindIndexBack (fun b -> b <> 0uy)
+                |> Option.map ((+) 1)
+                |> Option.defaultValue 0
+
+            let order =
+                match signal.ByteOrder with
+                | ByteOrder.Little -> "little"
+                | ByteOrder.Big -> "big"
+
+            [ sprintf
+                  "    struct %s : bits<%d, %d, byte_order::%s, %s> {"
+                  (signalTypeName message signal)
+                  (Utils.chooseStartBit signal config)
+                  (int signal.Length)
+                  order
+                  (if signal.IsSigned then "true" else "false")
+              sprintf "        static constexpr double factor = %.17g;" signal.Factor
+              sprintf "        static constexpr double offset = %.17g;" signal.Offset
+              sprintf "        static constexpr std::size_t min_bytes = %d;" minBytes
+              "    };" ]
+            |> String.concat "\n"
+
+        let private messageStruct (message: Message) (config: Signal.CANdy.Core.Config.Config) =
+            let signalTypes =
+                message.Signals |> List.map (signalTypeName message) |> String.concat ", "
+
+            [ sprintf "struct %s {" message.Name
+              sprintf "    static constexpr std::uint32_t id = %du;" (int message.Id)
+              sprintf "    static constexpr bool is_extended = %s;" (if message.IsExtended then "true" else "false")
+              sprintf "    static constexpr std::uint16_t length = %d;" (int message.Length)
+              sprintf "    static constexpr const char* name = \"%s\";" message.Name
+              yield! message.Signals |> List.map (fun s -> "\n" + signalStruct message s config)
+              ""
+              sprintf "    using signals = std::tuple<%s>;" signalTypes
+              "};" ]
+            |> String.concat "\n"
+
+        let generateCppHeader (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let hPath = Path.Combine(outputPath, "include", cppHeaderName config)
+
+            let guard =
+                (config.FilePrefix + "signals_hpp").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let messageStructs =
+                ir.Messages
+                |> List.map (fun m -> messageStruct m config)
+                |> String.concat "\n\n"
+
+            let visitCases =
+                ir.Messages
+                |> List.distinctBy (fun m -> m.Id)
+                |> List.sortBy (fun m -> m.Id)
+                |> List.map (fun m -> sprintf "        case %du: f(msg::%s{}); return true;" (int m.Id) m.Name)
+                |> String.concat "\n"
+
+            let model: (string * obj) list =
+                [ "banner", box banner
+                  "header_guard", box guard
+                  "message_structs", box messageStructs
+                  "visit_cases", box visitCases ]
+
+            File.WriteAllText(hPath, Templates.renderOrRaise "signals.hpp.scriban" model)
+            hPath
+
+    module DescriptorBlob =
+        let engineHeaderName (config: Signal.CANdy.Core.Config.Config) = sprintf "%sdbc_engine.h" config.FilePrefix
+
+        let engineSourceName (config: Signal.CANdy.Core.Config.Config) = sprintf "%sdbc_engine.c" config.FilePrefix
+
+        let blobName (config: Signal.CANdy.Core.Config.Config) = sprintf "%sdbc.bin" config.FilePrefix
+
+        // Record sizes must match scdb_header_t / scdb_message_t / scdb_signal_t / scdb_aux_t /
+        // scdb_value_t in dbc_engine.h.scriban; bump the version on any layout change.
+        let private formatVersion = 1us
+        let private headerSize = 56
+
+        let private sigBigEndian = 0x0001us
+        let private sigSigned = 0x0002us
+        let private sigMuxSwitch = 0x0004us
+        let private sigMuxBranch = 0x0008us
+        let private sigHasMin = 0x0010us
+        let private sigHasMax = 0x0020us
+        let private sigCrc = 0x0040us
+        let private sigCounter = 0x0080us
+
+        let private crc32 (bytes: byte[]) (start: int) =
+            let mutable crc = 0xFFFFFFFFu
+
+            for i in start .. bytes.Length - 1 do
+                crc <- crc ^^^ uint32 bytes.[i]
+
+                for _ in 1..8 do
+                    crc <- if crc &&& 1u <> 0u then (crc >>> 1) ^^^ 0xEDB88320u else crc >>> 1
+
+            crc ^^^ 0xFFFFFFFFu
+
+        let private algorithmName (algorithm: CrcAlgorithmId) =
+            match algorithm with
+            | CrcAlgorithmId.CRC8_SAE_J1850 -> "CRC8_SAE_J1850"
+            | CrcAlgorithmId.CRC8_8H2F -> "CRC8_8H2F"
+            | CrcAlgorithmId.CRC16_CCITT -> "CRC16_CCITT"
+            | CrcAlgorithmId.CRC32P4 -> "CRC32P4"
+            | CrcAlgorithmId.Custom name -> name
+
+        // Serialize the IR (after config metadata) into the versioned little-endian blob read by
+        // scdb_load. Messages and signals keep DBC order; equal strings are stored once.
+        let buildBlob (ir: Ir) (config: Signal.CANdy.Core.Config.Config) : byte[] =
+            let strings = new MemoryStream()
+            strings.WriteByte 0uy
+            let stringOffsets = Collections.Generic.Dictionary<string, uint32>()
+            stringOffsets.[""] <- 0u
+
+            let intern (s: string) =
+                match stringOffsets.TryGetValue s with
+                | true, offset -> offset
+                | _ ->
+                    let offset = uint32 strings.Length
+                    let bytes = Text.Encoding.UTF8.GetBytes s
+                    strings.Write(bytes, 0, bytes.Length)
+                    strings.WriteByte 0uy
+                    stringOffsets.[s] <- offset
+                    offset
+
+            let messages = new MemoryStream()
+            let signals = new MemoryStream()
+            let aux = new MemoryStream()
+            let values = new MemoryStream()
+            let mw = new BinaryWriter(messages)
+            let sw = new BinaryWriter(signals)
+            let aw = new BinaryWriter(aux)
+            let vw = new BinaryWriter(values)
+            let mutable signalCount = 0u
+            let mutable auxCount = 0u
+            let mutable valueCount = 0u
+
+            for m in ir.Messages do
+                let muxSwitch =
+                    m.Signals
+                    |> List.tryFindIndex (fun s -> s.MultiplexerIndicator = Some "M")
+                    |> Option.defaultValue -1
+
+                let flags =
+                    (if m.IsExtended then 0x0001us else 0us)
+                    ||| (match m.CrcCounterMode with
+                         | Some CrcCounterMode.Validate -> 0x0002us
+                         | Some CrcCounterMode.Passthrough -> 0x0004us
+                         | Some CrcCounterMode.FailFast -> 0x0008us
+                         | None -> 0us)
+
+                mw.Write(m.Id)
+                mw.Write(intern m.Name)
+                mw.Write(intern m.Sender)
+                mw.Write(signalCount)
+                mw.Write(uint16 m.Signals.Length)
+                mw.Write(m.Length)
+                mw.Write(flags)
+                mw.Write(int16 muxSwitch)
+                mw.Write(uint32 (defaultArg m.CycleTimeMs 0))
+                mw.Write(uint32 (defaultArg m.StartDelayMs 0))
+
+                for s in m.Signals do
+                    let muxValue, muxFlags =
+                        match s.MultiplexerIndicator, s.MultiplexerSwitchValue with
+                        | Some "M", _ -> 0, sigMuxSwitch
+                        | Some "m", Some v -> v, sigMuxBranch
+                        | _ -> 0, 0us
+
+                    let auxIndex =
+                        match s.CrcMeta, s.CounterMeta with
+                        | Some crc, _ ->
+                            aw.Write(crc.Params.Poly)
+                            aw.Write(crc.Params.Init)
+                            aw.Write(crc.Params.XorOut)
+                            aw.Write(intern (algorithmName crc.Algorithm))
+                            aw.Write(0u)
+                            aw.Write(0u)
+                            aw.Write(0u)
+                            aw.Write(uint16 crc.ByteRange.Start)
+                            aw.Write(uint16 crc.ByteRange.End)
+                            aw.Write(defaultArg crc.DataId 0us)
+                            aw.Write(byte crc.Params.Width)
+
+                            aw.Write(
+                                (if crc.Params.ReflectIn then 0x01uy else 0uy)
+                                ||| (if crc.Params.ReflectOut then 0x02uy else 0uy)
+                                ||| (if crc.DataId.IsSome then 0x04uy else 0uy)
+                            )
+
+                            auxCount <- auxCount + 1u
+                            auxCount - 1u
+                        | None, Some counter ->
+                            aw.Write(0UL)
+                            aw.Write(0UL)
+                            aw.Write(0UL)
+                            aw.Write(0u)
+                            aw.Write(uint32 counter.Modulus)
+                            aw.Write(uint32 counter.Increment)
+                            aw.Write(uint32 counter.MaxDelta)
+                            aw.Write(0us)
+                            aw.Write(0us)
+                            aw.Write(0us)
+                            aw.Write(0uy)
+                            aw.Write(0uy)
+                            auxCount <- auxCount + 1u
+                            auxCount - 1u
+                        | None, None -> 0xFFFFFFFFu
+
+                    let entries = defaultArg s.ValueTable []
+                    let firstValue = valueCount
+
+                    for (v, name) in entries do
+                        vw.Write(v)
+                        vw.Write(intern name)
+                        valueCount <- valueCount + 1u
+
+                    let flags =
+                        (if s.ByteOrder = ByteOrder.Big then sigBigEndian else 0us)
+                        ||| (if s.IsSigned then sigSigned else 0us)
+                        ||| muxFlags
+                        ||| (if s.Minimum.IsSome then sigHasMin else 0us)
+                        ||| (if s.Maximum.IsSome then sigHasMax else 0us)
+                        ||| (if s.CrcMeta.IsSome then sigCrc else 0us)
+                        ||| (if s.CounterMeta.IsSome && s.CrcMeta.IsNone then sigCounter else 0us)
+
+                    sw.Write(s.Factor)
+                    sw.Write(s.Offset)
+                    sw.Write(defaultArg s.Minimum 0.0)
+                    sw.Write(defaultArg s.Maximum 0.0)
+                    sw.Write(intern s.Name)
+                    sw.Write(intern s.Unit)
+                    sw.Write(uint16 (Utils.chooseStartBit s config))
+                    sw.Write(s.Length)
+                    sw.Write(flags)
+                    sw.Write(uint16 entries.Length)
+                    sw.Write(firstValue)
+                    sw.Write(muxValue)
+                    sw.Write(auxIndex)
+                    sw.Write(0u)
+                    signalCount <- signalCount + 1u
+
+            // Every record size is a multiple of 8, so sections stay aligned back to back.
+            let messagesOffset = headerSize
+            let signalsOffset = messagesOffset + int messages.Length
+            let auxOffset = signalsOffset + int signals.Length
+            let valuesOffset = auxOffset + int aux.Length
+            let stringsOffset = valuesOffset + int values.Length
+            let totalSize = stringsOffset + int strings.Length
+
+            let blob = Array.zeroCreate<byte> totalSize
+
+            let copy (section: MemoryStream) (offset: int) =
+                section.ToArray().CopyTo(blob, offset)
+
+            copy messages messagesOffset
+            copy signals signalsOffset
+            copy aux auxOffset
+            copy values valuesOffset
+            copy strings stringsOffset
+
+            use header = new MemoryStream(blob, 0, headerSize)
+            use hw = new BinaryWriter(header)
+            hw.Write(0x42444353u)
+            hw.Write(formatVersion)
+            hw.Write(uint16 headerSize)
+            hw.Write(uint32 totalSize)
+            hw.Write(crc32 blob headerSize)
+            hw.Write(uint32 ir.Messages.Length)
+            hw.Write(uint32 messagesOffset)
+            hw.Write(signalCount)
+            hw.Write(uint32 signalsOffset)
+            hw.Write(auxCount)
+            hw.Write(uint32 auxOffset)
+            hw.Write(valueCount)
+            hw.Write(uint32 valuesOffset)
+            hw.Write(uint32 strings.Length)
+            hw.Write(uint32 stringsOffset)
+            hw.Flush()
+            blob
+
+        let generateDescriptorFiles (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let hName = engineHeaderName config
+            let hPath = Path.Combine(outputPath, "include", hName)
+            let cPath = Path.Combine(outputPath, "src", engineSourceName config)
+            let binPath = Path.Combine(outputPath, blobName config)
+
+            let guard =
+                (config.FilePrefix + "dbc_engine_h").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let headerModel: (string * obj) list =
+                [ "banner", box banner
+                  "header_guard", box guard
+                  "blob_name", box (blobName config) ]
+
+            let sourceModel: (string * obj) list =
+                [ "banner", box banner; "engine_header_name", box hName ]
+
+            File.WriteAllText(hPath, Templates.renderOrRaise "dbc_engine.h.scriban" headerModel)
+            File.WriteAllText(cPath, Templates.renderOrRaise "dbc_engine.c.scriban" sourceModel)
+            File.WriteAllBytes(binPath, buildBlob ir config)
+            (hPath, cPath), binPath
+
+    module ArrowWriter =
+        let writerHeaderName (config: Signal.CANdy.Core.Config.Config) = sprintf "%sarrow_writer.h" config.FilePrefix
+
+        let writerSourceName (config: Signal.CANdy.Core.Config.Config) = sprintf "%sarrow_writer.c" config.FilePrefix
+
+        // Minimal FlatBuffers object model for the Arrow IPC metadata (Message.fbs / Schema.fbs).
+        type private FbObject =
+            | FbTable of (int * FbField) list
+            | FbString of string
+            | FbTables of FbObject list
+            | FbStructs of marker: string * count: int * size: int
+
+        and private FbField =
+            | FbByte of byte
+            | FbShort of int16
+            | FbInt of int32
+            | FbLong of marker: string option * int64
+            | FbRef of FbObject
+
+        let private fieldSize =
+            function
+            | FbByte _ -> 1
+            | FbShort _ -> 2
+            | FbInt _
+            | FbRef _ -> 4
+            | FbLong _ -> 8
+
+        // Serialize front to back: every table is preceded by its vtable and followed by its
+        // children, so all uoffsets point forward. Returns the buffer and the absolute position of
+        // each marked long / struct vector, which the C writer patches per record batch.
+        let private serialize (root: FbObject) =
+            let ms = new MemoryStream()
+            let bw = new BinaryWriter(ms)
+            let markers = Collections.Generic.Dictionary<string, int>()
+            let align (n: int) = while ms.Position % int64 n <> 0L do bw.Write 0uy
+            let pos () = int ms.Position
+
+            let patch (slot: int) (target: int) =
+                let back = ms.Position
+                ms.Position <- int64 slot
+                bw.Write(uint32 (target - slot))
+                ms.Position <- back
+
+            let rec write (obj: FbObject) : int =
+                match obj with
+                | FbString s ->
+                    align 4
+                    let at = pos ()
+                    let bytes = Text.Encoding.UTF8.GetBytes s
+                    bw.Write(uint32 bytes.Length)
+                    bw.Write(bytes)
+                    bw.Write 0uy
+                    at
+                | FbTables items ->
+                    align 4
+                    let at = pos ()
+                    bw.Write(uint32 items.Length)
+                    let first = pos ()
+                    items |> List.iter (fun _ -> bw.Write 0u)
+                    items |> List.iteri (fun i item -> patch (first + 4 * i) (write item))
+                    at
+                | FbStructs(marker, count, size) ->
+                    while (ms.Position + 4L) % 8L <> 0L do bw.Write 0uy
+                    let at = pos ()
+                    bw.Write(uint32 count)
+                    markers.[marker] <- pos ()
+                    bw.Write(Array.zeroCreate<byte> (count * size))
+                    at
+                | FbTable fields ->
+                    // Inline layout: soffset at 0, then fields by descending size, naturally aligned.
+                    let layout =
+                        fields
+                        |> List.sortByDescending (fun (_, f) -> fieldSize f)
+                        |> List.mapFold
+                            (fun cursor (id, f) ->
+                                let size = fieldSize f
+                                let offset = (cursor + size - 1) / size * size
+                                (id, f, offset), offset + size)
+                            4
+
+                    let placed, tableSize = layout
+                    let slotCount = (fields |> List.map fst |> List.fold max -1) + 1
+                    align 2
+                    let vtable = pos ()
+                    bw.Write(uint16 (4 + 2 * slotCount))
+                    bw.Write(uint16 tableSize)
+
+                    for id in 0 .. slotCount - 1 do
+                        let offset =
+                            placed |> List.tryPick (fun (i, _, o) -> if i = id then Some o else None)
+
+                        bw.Write(uint16 (defaultArg offset 0))
+
+                    align 8
+                    let at = pos ()
+                    bw.Write(Array.zeroCreate<byte> tableSize)
+                    ms.Position <- int64 at
+                    bw.Write(int32 (at - vtable))
+
+                    let refs =
+                        placed
+                        |> List.choose (fun (_, f, offset) ->
+                            ms.Position <- int64 (at + offset)
+
+                            match f with
+                            | FbByte v ->
+                                bw.Write v
+                                None
+                            | FbShort v ->
+                                bw.Write v
+                                None
+                            | FbInt v ->
+                                bw.Write v
+                                None
+                            | FbLong(marker, v) ->
+                                marker |> Option.iter (fun m -> markers.[m] <- at + offset)
+                                bw.Write v
+                                None
+                            | FbRef child -> Some(at + offset, child))
+
+                    ms.Position <- int64 (at + tableSize)
+                    refs |> List.iter (fun (slot, child) -> patch slot (write child))
+                    at
+
+            bw.Write 0u
+            patch 0 (write root)
+            align 8
+            ms.ToArray(), markers
+
+        // Encapsulated IPC message: continuation marker, metadata length, 8-byte aligned metadata.
+        let private ipcMessage (root: FbObject) =
+            let body, markers = serialize root
+            let framed = Array.concat [ BitConverter.GetBytes 0xFFFFFFFFu; BitConverter.GetBytes(int32 body.Length); body ]
+            framed, (markers |> Seq.map (fun kv -> kv.Key, kv.Value + 8) |> Map.ofSeq)
+
+        let private metadataVersionV5 = 4s
+        let private headerSchema = 1uy
+        let private headerRecordBatch = 3uy
+        let private typeInt = 2uy
+        let private typeFloatingPoint = 3uy
+        let private typeTimestamp = 10uy
+
+        let private keyValues (pairs: (string * string) list) =
+            pairs
+            |> List.map (fun (k, v) -> FbTable [ 0, FbRef(FbString k); 1, FbRef(FbString v) ])
+            |> FbTables
+
+        // int32 only where the float struct field holds the raw value exactly.
+        let private isIntColumn (s: Signal) =
+            s.Factor = 1.0 && s.Offset = 0.0 && s.Length <= 24us
+
+        let private field (name: string) (nullable: bool) (typeId: byte) (typeTable: FbObject) (metadata: (string * string) list) =
+            FbTable
+                [ yield 0, FbRef(FbString name)
+                  yield 1, FbByte(if nullable then 1uy else 0uy)
+                  yield 2, FbByte typeId
+                  yield 3, FbRef typeTable
+                  yield 5, FbRef(FbTables [])
+                  if not metadata.IsEmpty then
+                      yield 6, FbRef(keyValues metadata) ]
+
+        let private schemaMessage (message: Message) (nullable: Signal -> bool) =
+            let timeField =
+                field "time" false typeTimestamp (FbTable [ 0, FbShort 2s ]) []
+
+            let signalFields =
+                message.Signals
+                |> List.map (fun s ->
+                    let typeId, typeTable =
+                        if isIntColumn s then
+                            typeInt, FbTable [ 0, FbInt 32; 1, FbByte 1uy ]
+                        else
+                            typeFloatingPoint, FbTable [ 0, FbShort 1s ]
+
+                    field s.Name (nullable s) typeId typeTable (if s.Unit = "" then [] else [ "unit", s.Unit ]))
+
+            let schema =
+                FbTable
+                    [ 0, FbShort 0s
+                      1, FbRef(FbTables(timeField :: signalFields))
+                      2, FbRef(keyValues [ "message", message.Name; "can_id", sprintf "0x%X" message.Id ]) ]
+
+            ipcMessage (
+                FbTable
+                    [ 0, FbShort metadataVersionV5
+                      1, FbByte headerSchema
+                      2, FbRef schema
+                      3, FbLong(None, 0L) ]
+            )
+            |> fst
+
+        let private batchMessage (columnCount: int) =
+            let recordBatch =
+                FbTable
+                    [ 0, FbLong(Some "length", 0L)
+                      1, FbRef(FbStructs("nodes", columnCount, 16))
+                      2, FbRef(FbStructs("buffers", 2 * columnCount, 16)) ]
+
+            ipcMessage (
+                FbTable
+                    [ 0, FbShort metadataVersionV5
+                      1, FbByte headerRecordBatch
+                      2, FbRef recordBatch
+                      3, FbLong(Some "body", 0L) ]
+            )
+
+        let private byteArray (name: string) (bytes: byte[]) =
+            let rows =
+                bytes
+                |> Array.chunkBySize 16
+                |> Array.map (fun chunk -> "    " + (chunk |> Array.map (sprintf "0x%02X,") |> String.concat " "))
+                |> String.concat "\n"
+
+            sprintf "static const uint8_t %s[%d] = {\n%s\n};" name bytes.Length rows
+
+        let generateWriterFiles (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let hName = writerHeaderName config
+            let hPath = Path.Combine(outputPath, "include", hName)
+            let cPath = Path.Combine(outputPath, "src", writerSourceName config)
+
+            let guard =
+                (config.FilePrefix + "arrow_writer_h").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let messages = ir.Messages |> List.distinctBy (fun m -> m.Id)
+
+            let tables =
+                messages
+                |> List.map (fun m ->
+                    let switchOpt, _, branches = Message.partitionMultiplex m
+                    let isMux = switchOpt.IsSome && not branches.IsEmpty
+                    let branchNames = branches |> List.collect snd |> List.map (fun s -> s.Name) |> Set.ofList
+                    let nullable (s: Signal) = isMux && branchNames.Contains s.Name
+                    m, nullable)
+
+            let descriptors =
+                tables
+                |> List.map (fun (m, nullable) ->
+                    let columns = 1 + m.Signals.Length
+                    let schema = schemaMessage m nullable
+                    let batch, markers = batchMessage columns
+
+                    let widths =
+                        "8" :: (m.Signals |> List.map (fun _ -> "4")) |> String.concat ", "
+
+                    let nullables =
+                        "0" :: (m.Signals |> List.map (fun s -> if nullable s then "1" else "0"))
+                        |> String.concat ", "
+
+                    let arrays =
+                        [ byteArray (sprintf "aw_schema_%s" m.Name) schema
+                          byteArray (sprintf "aw_batch_%s" m.Name) batch
+                          sprintf "static const uint8_t aw_widths_%s[%d] = { %s };" m.Name columns widths
+                          sprintf "static const uint8_t aw_nullable_%s[%d] = { %s };" m.Name columns nullables ]
+                        |> String.concat "\n"
+
+                    let entry =
+                        sprintf
+                            "    { \"%s.arrows\", aw_schema_%s, sizeof(aw_schema_%s), aw_batch_%s, sizeof(aw_batch_%s), %du, %du, %du, %du, %du, aw_widths_%s, aw_nullable_%s },"
+                            m.Name
+                            m.Name
+                            m.Name
+                            m.Name
+                            m.Name
+                            markers.["body"]
+                            markers.["length"]
+                            markers.["nodes"]
+                            markers.["buffers"]
+                            columns
+                            m.Name
+                            m.Name
+
+                    arrays, entry)
+
+            let descTable =
+                [ yield! descriptors |> List.map fst
+                  yield ""
+                  yield "static const aw_desc_t aw_descs[AW_TABLE_SLOTS] = {"
+                  if descriptors.IsEmpty then
+                      yield "    { NULL, NULL, 0u, NULL, 0u, 0u, 0u, 0u, 0u, 0u, NULL, NULL }"
+                  else
+                      yield! descriptors |> List.map snd
+                  yield "};" ]
+                |> String.concat "\n"
+
+            let fillFunctions =
+                tables
+                |> List.map (fun (m, nullable) ->
+                    let validTest (s: Signal) =
+                        let macro = sprintf "%s_VALID_%s" (m.Name.ToUpperInvariant()) (s.Name.ToUpperInvariant())
+
+                        if m.Signals.Length > 64 then
+                            sprintf "sc_valid_test(m->valid, %s)" macro
+                        else
+                            sprintf "m->valid & %s" macro
+
+                    let rows =
+                        m.Signals
+                        |> List.mapi (fun i s ->
+                            let column = i + 1
+                            let ctype, value =
+                                if isIntColumn s then "int32_t", sprintf "(int32_t)m->%s" s.Name else "float", sprintf "m->%s" s.Name
+
+                            let store v = sprintf "AW_COLUMN(t, %d, %s)[r] = %s;" column ctype v
+
+                            if nullable s then
+                                sprintf
+                                    "    if (%s) { %s aw_set_valid(t, %d, r); } else { %s }"
+                                    (validTest s)
+                                    (store value)
+                                    column
+                                    (store "0")
+                            else
+                                "    " + store value)
+
+                    [ sprintf "static void aw_fill_%s(aw_table_t* t, uint32_t r, const %s_t* m) {" m.Name m.Name
+                      yield! rows
+                      "}" ]
+                    |> String.concat "\n")
+                |> String.concat "\n\n"
+
+            let indexCases =
+                messages
+                |> List.mapi (fun k m -> sprintf "        case %du: return %d;" (int m.Id) k)
+                |> String.concat "\n"
+
+            let fillCases =
+                messages
+                |> List.mapi (fun k m -> sprintf "        case %d: aw_fill_%s(t, r, &m->m_%s); break;" k m.Name m.Name)
+                |> String.concat "\n"
+
+            let headerContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_guard", box guard
+                      "table_count", box messages.Length ]
+
+                Templates.renderOrRaise "arrow_writer.h.scriban" model
+
+            let sourceContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "writer_header_name", box hName
+                      "utils_header_name", box (Utils.utilsHeaderName config)
+                      "registry_header_name", box (sprintf "%sregistry.h" config.FilePrefix)
+                      "message_includes",
+                      box (
+                          messages
+                          |> List.map (fun m -> sprintf "#include \"%s.h\"" (m.Name.ToLowerInvariant()))
+                          |> String.concat "\n"
+                      )
+                      "message_union",
+                      box (messages |> List.map (fun m -> sprintf "    %s_t m_%s;" m.Name m.Name) |> String.concat "\n")
+                      "desc_table", box descTable
+                      "fill_functions", box fillFunctions
+                      "index_cases", box indexCases
+                      "fill_cases", box fillCases ]
+
+                Templates.renderOrRaise "arrow_writer.c.scriban" model
+
+            File.WriteAllText(hPath, headerContent)
+            File.WriteAllText(cPath, sourceContent)
+            hPath, cPath
+
+    module SocketCan =
+        let adapterHeaderName (config: Signal.CANdy.Core.Config.Config) = sprintf "%ssocketcan.h" config.FilePrefix
+
+        let adapterSourceName (config: Signal.CANdy.Core.Config.Config) = sprintf "%ssocketcan.c" config.FilePrefix
+
+        // Above this many distinct IDs the prime implicant search is skipped: dense ID ranges
+        // produce up to 3^bits intermediate cubes and take seconds to cover.
+        let exactMergeLimit = 256
+
+        // Exact cover by aligned power-of-two ID blocks: linear after sorting, never accepts
+        // an extra ID, but misses merges across unaligned or non-contiguous IDs.
+        let private mergeAlignedBlocks (full: uint32) (minterms: uint32 list) =
+            let sorted = minterms |> List.sort |> List.toArray
+            let blocks = ResizeArray<uint32 * uint32>()
+            let mutable i = 0
+
+            while i < sorted.Length do
+                let value = sorted.[i]
+                let mutable size = 1
+
+                while (uint64 size * 2UL) - 1UL <= uint64 full
+                      && value &&& uint32 (size * 2 - 1) = 0u
+                      && i + size * 2 - 1 < sorted.Length
+                      && sorted.[i + size * 2 - 1] = value + uint32 (size * 2 - 1) do
+                    size <- size * 2
+
+                blocks.Add(value, full &&& ~~~(uint32 (size - 1)))
+                i <- i + size
+
+            List.ofSeq blocks
+
+        // Exact id/mask cover of a set of IDs: Quine-McCluskey prime implicants (cubes of
+        // (value, don't-care bits)), then essential primes and a greedy cover of the rest.
+        // Sets larger than exactMergeLimit fall back to aligned blocks.
+        // Returns (id, mask) pairs with mask limited to width bits.
+        let mergeFilters (width: int) (ids: uint32 list) : (uint32 * uint32) list =
+            let full = if width >= 32 then UInt32.MaxValue else (1u <<< width) - 1u
+            let minterms = ids |> List.map (fun id -> id &&& full) |> List.distinct
+
+            if minterms.Length > exactMergeLimit then
+                mergeAlignedBlocks full minterms
+            else
+                let rec primes (level: Set<uint32 * uint32>) (acc: (uint32 * uint32) list) =
+                    if level.IsEmpty then
+                        acc
+                    else
+                        let merged = Collections.Generic.HashSet<uint32 * uint32>()
+                        let mutable next = Set.empty
+
+                        for (value, dc) in level do
+                            for bit in 0 .. width - 1 do
+                                let b = 1u <<< bit
+
+                                if dc &&& b = 0u && value &&& b = 0u && level.Contains(value ||| b, dc) then
+                                    merged.Add(value, dc) |> ignore
+                                    merged.Add(value ||| b, dc) |> ignore
+                                    next <- next.Add(value, dc ||| b)
+
+                        let unmerged = level |> Seq.filter (fun c -> not (merged.Contains c)) |> Seq.toList
+                        primes next (acc @ unmerged)
+
+                let candidates = primes (minterms |> List.map (fun id -> id, 0u) |> Set.ofList) []
+                let present = Set.ofList minterms
+
+                // Minterms of a cube: every assignment of its don't-care bits.
+                let expand (value: uint32, dc: uint32) =
+                    let rec go (sub: uint32) acc =
+                        let acc = (value ||| sub) :: acc
+                        if sub = 0u then acc else go ((sub - 1u) &&& dc) acc
+
+                    go dc [] |> List.filter present.Contains
+
+                let covered = candidates |> List.map (fun c -> c, expand c)
+
+                let owners =
+                    covered
+                    |> List.collect (fun (c, ids) -> ids |> List.map (fun id -> id, c))
+                    |> List.groupBy fst
+
+                let essential =
+                    owners
+                    |> List.choose (fun (_, cs) ->
+                        match cs with
+                        | [ (_, only) ] -> Some only
+                        | _ -> None)
+                    |> List.distinct
+
+                let left = Collections.Generic.HashSet<uint32>(minterms)
+
+                for c in essential do
+                    for id in expand c do
+                        left.Remove id |> ignore
+
+                let mutable chosen = essential
+
+                while left.Count > 0 do
+                    let best, ids =
+                        covered
+                        |> List.maxBy (fun ((value, dc), ids) ->
+                            ids |> List.filter left.Contains |> List.length, Numerics.BitOperations.PopCount dc, -(int64 value))
+
+                    chosen <- best :: chosen
+
+                    for id in ids do
+                        left.Remove id |> ignore
+
+                chosen
+                |> List.sort
+                |> List.map (fun (value, dc) -> value, full &&& ~~~dc)
+
+        // Enumerator suffix for a node name.
+        let private nodeToken (node: string) =
+            node.ToUpperInvariant()
+            |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+            |> Seq.toArray
+            |> fun arr -> new string (arr)
+
+        // Filter sets: the whole registry, then the RX set of each receiving node, in name order.
+        let filterSets (messages: Message list) : (string * string * Message list) list =
+            let nodes =
+                messages
+                |> List.collect (fun m -> m.Receivers)
+                |> List.groupBy nodeToken
+                |> List.sortBy fst
+
+            ("ALL", "every registry message", messages)
+            :: (nodes
+                |> List.map (fun (token, names) ->
+                    let names = List.distinct names
+
+                    sprintf "NODE_%s" token,
+                    sprintf "messages received by %s" (String.concat ", " names),
+                    messages |> List.filter (fun m -> m.Receivers |> List.exists (fun r -> List.contains r names))))
+
+        let private filterEntries (messages: Message list) =
+            let standard, extended = messages |> List.partition (fun m -> not m.IsExtended)
+
+            (mergeFilters 11 (standard |> List.map (fun m -> m.Id))
+             |> List.map (fun (id, mask) -> sprintf "    { 0x%03Xu, 0x%03Xu | CAN_EFF_FLAG | CAN_RTR_FLAG }," id mask))
+            @ (mergeFilters 29 (extended |> List.map (fun m -> m.Id))
+               |> List.map (fun (id, mask) ->
+                   sprintf "    { 0x%08Xu | CAN_EFF_FLAG, 0x%08Xu | CAN_EFF_FLAG | CAN_RTR_FLAG }," id mask))
+
+        let generateAdapterFiles (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let hName = adapterHeaderName config
+            let hPath = Path.Combine(outputPath, "include", hName)
+            let cPath = Path.Combine(outputPath, "src", adapterSourceName config)
+
+            let guard =
+                (config.FilePrefix + "socketcan_h").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let messages = ir.Messages |> List.distinctBy (fun m -> m.Id)
+
+            let sets = filterSets messages
+
+            let headerContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_guard", box guard
+                      "filter_enum",
+                      box (
+                          sets
+                          |> List.mapi (fun i (name, comment, _) ->
+                              sprintf "    SOCKETCAN_FILTER_%s = %d, /* %s */" name i comment)
+                          |> String.concat "\n"
+                      )
+                      "filter_set_count", box (List.length sets) ]
+
+                Templates.renderOrRaise "socketcan.h.scriban" model
+
+            let setEntries = sets |> List.map (fun (name, _, members) -> name, filterEntries members)
+
+            let filterTables =
+                setEntries
+                |> List.choose (fun (name, entries) ->
+                    match entries with
+                    | [] -> None
+                    | entries ->
+                        Some(
+                            sprintf
+                                "static const struct can_filter sc_filter_%s[] = {\n%s\n};"
+                                (name.ToLowerInvariant())
+                                (String.concat "\n" entries)
+                        ))
+                |> String.concat "\n\n"
+
+            let filterSetEntries =
+                setEntries
+                |> List.map (fun (name, entries) ->
+                    if List.isEmpty entries then
+                        "    { NULL, 0u },"
+                    else
+                        let table = sprintf "sc_filter_%s" (name.ToLowerInvariant())
+                        sprintf "    { %s, sizeof(%s) / sizeof(%s[0]) }," table table table)
+                |> String.concat "\n"
+
+            // FD format follows the DBC length; BRS is left to SOCKETCAN_TX_BRS.
+            let encodeCases =
+                messages
+                |> List.map (fun m ->
+                    let flags =
+                        [ if m.IsExtended then "SOCKETCAN_TX_EXTENDED"
+                          if m.Length > 8us then "SOCKETCAN_TX_FD"
+                          if m.Length > 8us then "(SOCKETCAN_TX_BRS ? SOCKETCAN_TX_FD_BRS : 0u)" ]
+
+                    let setFlags =
+                        if List.isEmpty flags then
+                            ""
+                        else
+                            sprintf "\n            flags = (uint8_t)(%s);" (String.concat " | " flags)
+
+                    sprintf
+                        "        case 0x%Xu:\n            if (!%s_encode(frame->data, &len, (const %s_t*)msg)) return false;%s\n            break;"
+                        m.Id
+                        m.Name
+                        m.Name
+                        setFlags)
+                |> String.concat "\n"
+
+            let sourceContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "socketcan_header_name", box hName
+                      "registry_header_name", box (sprintf "%sregistry.h" config.FilePrefix)
+                      "message_includes",
+                      box (
+                          messages
+                          |> List.map (fun m -> sprintf "#include \"%s.h\"" (m.Name.ToLowerInvariant()))
+                          |> String.concat "\n"
+                      )
+                      "message_union",
+                      box (messages |> List.map (fun m -> sprintf "    %s_t m_%s;" m.Name m.Name) |> String.concat "\n")
+                      "encode_cases", box encodeCases
+                      "filter_tables", box filterTables
+                      "filter_set_entries", box filterSetEntries ]
+
+                Templates.renderOrRaise "socketcan.c.scriban" model
+
+            File.WriteAllText(hPath, headerContent)
+            File.WriteAllText(cPath, sourceContent)
+            hPath, cPath
+
+    module Ebpf =
+        let headerName (config: Signal.CANdy.Core.Config.Config) = sprintf "%scan_bpf.h" config.FilePrefix
+
+        let programName (config: Signal.CANdy.Core.Config.Config) = sprintf "%scan_bpf.bpf.c" config.FilePrefix
+
+        let userSourceName (config: Signal.CANdy.Core.Config.Config) = sprintf "%scan_bpf_user.c" config.FilePrefix
+
+        let private objectName (config: Signal.CANdy.Core.Config.Config) = sprintf "%scan_bpf.bpf.o" config.FilePrefix
+
+        let private ident (s: string) =
+            s.ToUpperInvariant()
+            |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+            |> Seq.toArray
+            |> fun arr -> new string (arr)
+
+        /// Runs of a signal's raw bits inside the payload, walked like get_bits_le / get_bits_be:
+        /// (byte, low bit, bit count, shift into the raw value), in raw bit order.
+        let bitRuns (signal: Signal) (config: Signal.CANdy.Core.Config.Config) =
+            let startEff = Utils.chooseStartBit signal config
+            let len = int signal.Length
+
+            let placements =
+                match signal.ByteOrder with
+                | ByteOrder.Little -> [ for i in 0 .. len - 1 -> i, (startEff + i) / 8, (startEff + i) % 8 ]
+                | ByteOrder.Big ->
+                    [ for i in 0 .. len - 1 ->
+                          let mutable curByte = startEff / 8
+                          let mutable curBit = startEff % 8 - i
+
+                          while curBit < 0 do
+                              curBit <- curBit + 8
+                              curByte <- curByte + 1
+
+                          len - 1 - i, curByte, curBit ]
+                |> List.sortBy (fun (rawBit, _, _) -> rawBit)
+
+            placements
+            |> List.fold
+                (fun runs (rawBit, byteIdx, bitIdx) ->
+                    match runs with
+                    | (b, low, count, shift) :: rest when b = byteIdx && low + count = bitIdx && shift + count = rawBit ->
+                        (b, low, count + 1, shift) :: rest
+                    | _ -> (byteIdx, bitIdx, 1, rawBit) :: runs)
+                []
+            |> List.rev
+
+        let private lastByte (signal: Signal) (config: Signal.CANdy.Core.Config.Config) =
+            bitRuns signal config |> List.map (fun (b, _, _, _) -> b) |> List.max
+
+        let private firstByte (signal: Signal) (config: Signal.CANdy.Core.Config.Config) =
+            bitRuns signal config |> List.map (fun (b, _, _, _) -> b) |> List.min
+
+        // Assemble a raw value from the loaded bytes b[] (b[0] is payload byte lo).
+        let private extractLines (var: string) (signal: Signal) (lo: int) (config: Signal.CANdy.Core.Config.Config) =
+            let len = int signal.Length
+
+            [ yield sprintf "    %s = 0;" var
+              for (b, low, count, shift) in bitRuns signal config do
+                  let mask = if count = 8 then "0xFFu" else sprintf "0x%Xu" ((1 <<< count) - 1)
+                  yield sprintf "    %s |= (__u64)((b[%d] >> %d) & %s) << %d;" var (b - lo) low mask shift
+              if signal.IsSigned && len < 64 then
+                  yield sprintf "    if (%s & (1ULL << %d)) %s |= ~((1ULL << %d) - 1);" var (len - 1) var len ]
+
+        /// Selected (message, signals) in configuration order; fails on entries the IR lacks.
+        let selection (ir: Ir) (config: Signal.CANdy.Core.Config.Config) : (Message * Signal list) list =
+            let picked =
+                config.EbpfSignals
+                |> List.distinct
+                |> List.map (fun entry ->
+                    let parts = entry.Split('.')
+
+                    match ir.Messages |> List.tryFind (fun m -> m.Name = parts.[0]) with
+                    | Some m ->
+                        match m.Signals |> List.tryFind (fun s -> s.Name = parts.[1]) with
+                        | Some s -> m, s
+                        | None -> failwithf "ebpf_signals: signal '%s' not found in message '%s'" parts.[1] parts.[0]
+                    | None -> failwithf "ebpf_signals: message '%s' not found" parts.[0])
+
+            picked
+            |> List.map fst
+            |> List.distinctBy (fun m -> m.Name)
+            |> List.map (fun m -> m, picked |> List.filter (fun (pm, _) -> pm.Name = m.Name) |> List.map snd)
+
+        let private canIdExpr (m: Message) =
+            if m.IsExtended then sprintf "0x%08Xu | CAN_EFF_FLAG" m.Id else sprintf "0x%03Xu" m.Id
+
+        let generateBpfFiles (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let bpfDir = Path.Combine(outputPath, "bpf")
+            Directory.CreateDirectory(bpfDir) |> ignore
+            let hName = headerName config
+            let selected = selection ir config
+
+            let indexed =
+                selected
+                |> List.collect (fun (m, sigs) -> sigs |> List.map (fun s -> m, s))
+                |> List.mapi (fun i (m, s) -> i, m, s)
+
+            let enumName (m: Message) (s: Signal) = sprintf "CAN_BPF_%s_%s" (ident m.Name) (ident s.Name)
+
+            let guard =
+                (config.FilePrefix + "can_bpf_h").ToUpperInvariant()
+                |> Seq.map (fun ch -> if Char.IsLetterOrDigit ch then ch else '_')
+                |> Seq.toArray
+                |> fun arr -> new string (arr)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let messageFunction (m: Message, sigs: Signal list) =
+                let switchOpt =
+                    if sigs |> List.exists (fun s -> s.MultiplexerIndicator = Some "m") then
+                        m.Signals |> List.tryFind (fun s -> s.MultiplexerIndicator = Some "M")
+                    else
+                        None
+
+                let spanned = sigs @ Option.toList switchOpt
+                let lo = spanned |> List.map (fun s -> firstByte s config) |> List.min
+                let hi = spanned |> List.map (fun s -> lastByte s config) |> List.max
+
+                let signalBlock (s: Signal) =
+                    let body =
+                        [ sprintf
+                              "    // %s: start=%d len=%d"
+                              s.Name
+                              (Utils.chooseStartBit s config)
+                              (int s.Length) ]
+                        @ extractLines "raw" s lo config
+                        @ [ sprintf "    cb_update(%s, raw, %d, now);" (enumName m s) (if s.IsSigned then 1 else 0) ]
+
+                    match s.MultiplexerIndicator, s.MultiplexerSwitchValue, switchOpt with
+                    | Some "m", Some v, Some _ ->
+                        [ sprintf "    if (sw == %du) {" v ] @ (body |> List.map (fun l -> "    " + l)) @ [ "    }" ]
+                    | _ -> body
+
+                [ yield sprintf "static __always_inline void cb_msg_%s(struct __sk_buff* skb, __u8 len, __u64 now) {" m.Name
+                  yield sprintf "    __u8 b[%d];" (hi - lo + 1)
+                  yield sprintf "    if (len < %d) return;" (hi + 1)
+                  yield sprintf "    if (bpf_skb_load_bytes(skb, CB_DATA_OFFSET + %d, b, sizeof(b)) < 0) return;" lo
+                  yield "    __u64 raw;"
+                  match switchOpt with
+                  | Some sw ->
+                      yield "    __u64 sw;"
+                      yield! extractLines "sw" sw lo config
+                  | None -> ()
+                  for s in sigs do
+                      yield! signalBlock s
+                  yield "}" ]
+                |> String.concat "\n"
+
+            let headerContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_guard", box guard
+                      "program_name", box (programName config)
+                      "user_source_name", box (userSourceName config)
+                      "object_name", box (objectName config)
+                      "signal_count", box (List.length indexed)
+                      "signal_enum",
+                      box (
+                          indexed
+                          |> List.map (fun (i, m, s) -> sprintf "    %s = %d," (enumName m s) i)
+                          |> String.concat "\n"
+                      ) ]
+
+                Templates.renderOrRaise "can_bpf.h.scriban" model
+
+            let programContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_name", box hName
+                      "program_name", box (programName config)
+                      "object_name", box (objectName config)
+                      "message_functions", box (selected |> List.map messageFunction |> String.concat "\n\n")
+                      "dispatch_cases",
+                      box (
+                          selected
+                          |> List.map (fun (m, _) ->
+                              sprintf "        case %s:\n            cb_msg_%s(skb, len, now);\n            break;" (canIdExpr m) m.Name)
+                          |> String.concat "\n"
+                      ) ]
+
+                Templates.renderOrRaise "can_bpf.bpf.c.scriban" model
+
+            let userContent =
+                let model: (string * obj) list =
+                    [ "banner", box banner
+                      "header_name", box hName
+                      "signal_infos",
+                      box (
+                          indexed
+                          |> List.map (fun (_, m, s) ->
+                              sprintf
+                                  "    { \"%s\", \"%s\", %s, %s, %.17g, %.17g },"
+                                  m.Name
+                                  s.Name
+                                  (canIdExpr m)
+                                  (if s.IsSigned then "true" else "false")
+                                  s.Factor
+                                  s.Offset)
+                          |> String.concat "\n"
+                      ) ]
+
+                Templates.renderOrRaise "can_bpf_user.c.scriban" model
+
+            let paths =
+                [ Path.Combine(bpfDir, hName), headerContent
+                  Path.Combine(bpfDir, programName config), programContent
+                  Path.Combine(bpfDir, userSourceName config), userContent ]
+
+            for (path, content) in paths do
+                File.WriteAllText(path, content)
+
+            paths |> List.map fst
+
+    module LogDecoder =
+        let toolName (config: Signal.CANdy.Core.Config.Config) = sprintf "%slog_decode" config.FilePrefix
+
+        let toolFileName (config: Signal.CANdy.Core.Config.Config) = toolName config + ".c"
+
+        // C string literal body; bytes outside printable ASCII become octal escapes.
+        let private cStringBody (s: string) =
+            Text.Encoding.UTF8.GetBytes s
+            |> Array.map (fun b ->
+                match char b with
+                | '"' -> "\\\""
+                | '\\' -> "\\\\"
+                | c when b >= 0x20uy && b < 0x7Fuy -> string c
+                | _ -> sprintf "\\%03o" b)
+            |> String.concat ""
+
+        let private csvField (s: string) =
+            if s.IndexOfAny([| ','; '"'; '\n'; '\r' |]) >= 0 then
+                "\"" + s.Replace("\"", "\"\"") + "\""
+            else
+                s
+
+        let private emitFunction (message: Message) =
+            let switchOpt, _, branches = Message.partitionMultiplex message
+            let isMux = switchOpt.IsSome && not branches.IsEmpty
+            let useValidArray = isMux && message.Signals.Length > 64
+
+            let rows =
+                message.Signals
+                |> List.mapi (fun idx s ->
+                    let row =
+                        sprintf
+                            "OUT_SIGNAL(o, f, \"0x%X,%s,%s,\", %d, m->%s);"
+                            message.Id
+                            message.Name
+                            s.Name
+                            idx
+                            s.Name
+
+                    let validMacro =
+                        sprintf "%s_VALID_%s" (message.Name.ToUpperInvariant()) (s.Name.ToUpperInvariant())
+
+                    if not isMux then
+                        "    " + row
+                    elif useValidArray then
+                        sprintf "    if (sc_valid_test(m->valid, %s)) { %s }" validMacro row
+                    else
+                        sprintf "    if (m->valid & %s) { %s }" validMacro row)
+
+            [ sprintf "static void emit_%s(log_out_t* o, const log_frame_t* f, const %s_t* m) {" message.Name message.Name
+              yield! rows
+              "}" ]
+            |> String.concat "\n"
+
+        let generateLogDecoder (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let toolsDir = Path.Combine(outputPath, "tools")
+            Directory.CreateDirectory(toolsDir) |> ignore
+            let path = Path.Combine(toolsDir, toolFileName config)
+
+            let banner =
+                sprintf
+                    "/* Generated by Signal CANdy\n   file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s */\n"
+                    config.FilePrefix
+                    config.PhysType
+                    config.PhysMode
+                    config.Dispatch
+                    config.MotorolaStartBit
+
+            let messages = ir.Messages |> List.distinctBy (fun m -> m.Id)
+
+            let includes =
+                messages
+                |> List.map (fun m -> sprintf "#include \"%s.h\"" (m.Name.ToLowerInvariant()))
+                |> String.concat "\n"
+
+            let messageUnion =
+                messages
+                |> List.map (fun m -> sprintf "    %s_t m_%s;" m.Name m.Name)
+                |> String.concat "\n"
+
+            let emitCases =
+                messages
+                |> List.map (fun m -> sprintf "        case %du: emit_%s(o, f, &m->m_%s); break;" (int m.Id) m.Name m.Name)
+                |> String.concat "\n"
+
+            let signalMap =
+                "    \"id,message,index,signal,unit\\n\""
+                :: (messages
+                    |> List.collect (fun m ->
+                        m.Signals
+                        |> List.mapi (fun idx s ->
+                            sprintf
+                                "    \"0x%X,%s,%d,%s,%s\\n\""
+                                m.Id
+                                m.Name
+                                idx
+                                s.Name
+                                (cStringBody (csvField s.Unit)))))
+                |> String.concat "\n"
+
+            let model: (string * obj) list =
+                [ "banner", box banner
+                  "tool_name", box (toolName config)
+                  "utils_header_name", box (Utils.utilsHeaderName config)
+                  "registry_header_name", box (sprintf "%sregistry.h" config.FilePrefix)
+                  "message_includes", box includes
+                  "message_union", box messageUnion
+                  "emit_functions", box (messages |> List.map emitFunction |> String.concat "\n\n")
+                  "emit_cases", box emitCases
+                  "signal_map", box signalMap
+                  "has_arrow", box config.ArrowWriter
+                  "arrow_header_name", box (ArrowWriter.writerHeaderName config) ]
+
+            File.WriteAllText(path, Templates.renderOrRaise "log_decode.c.scriban" model)
+            path
+
+    module Bench =
+        let benchName (config: Signal.CANdy.Core.Config.Config) = sprintf "%sbench" config.FilePrefix
+
+        let benchFileName (config: Signal.CANdy.Core.Config.Config) = benchName config + ".c"
+
+        let accessorSuiteName (config: Signal.CANdy.Core.Config.Config) = sprintf "%sbit_accessors" config.FilePrefix
+
+        let accessorSuiteFileName (config: Signal.CANdy.Core.Config.Config) = accessorSuiteName config + ".c"
+
+        // Generator settings as in the banner; the drivers also copy it into their JSON reports.
+        let private configLine (config: Signal.CANdy.Core.Config.Config) =
+            sprintf
+                "file_prefix=%s, phys_type=%s, phys_mode=%s, dispatch=%s, motorola_start_bit=%s"
+                config.FilePrefix
+                config.PhysType
+                config.PhysMode
+                config.Dispatch
+                config.MotorolaStartBit
+
+        /// Raw values a payload generator may draw for a signal, as (lowest raw, count - 1); the count
+        /// wraps to UInt64.MaxValue for a full 64-bit range. The range follows the DBC min/max the
+        /// decoder checks, nudged inward until the boundaries also pass after float rounding.
+        let rawRange (s: Signal) : int64 * uint64 =
+            let len = int s.Length
+
+            let fullLo, fullHi =
+                if len >= 64 then
+                    (if s.IsSigned then Int64.MinValue else 0L), Int64.MaxValue
+                elif s.IsSigned then
+                    -(1L <<< (len - 1)), (1L <<< (len - 1)) - 1L
+                else
+                    0L, (1L <<< len) - 1L
+
+            let full =
+                if len >= 64 then fullLo, UInt64.MaxValue else fullLo, uint64 (fullHi - fullLo)
+
+            let checkedBounds =
+                match s.Minimum, s.Maximum with
+                | Some minV, Some maxV when minV >= maxV -> None
+                | Some minV, Some maxV when Utils.isRawRangeSentinel minV maxV s.Factor s.Offset s.Length s.IsSigned -> None
+                | None, None -> None
+                | bounds -> Some bounds
+
+            match checkedBounds with
+            | None -> full
+            | Some _ when s.Factor = 0.0 -> full
+            | Some(minOpt, maxOpt) ->
+                let accepts (raw: int64) =
+                    let phys = float raw * s.Factor + s.Offset
+                    let narrow = float (float32 phys)
+
+                    let above v =
+                        minOpt |> Option.forall (fun m -> v >= m)
+
+                    let below v =
+                        maxOpt |> Option.forall (fun m -> v <= m)
+
+                    above phys && below phys && above narrow && below narrow
+
+                let toRaw (phys: float) = (phys - s.Offset) / s.Factor
+                let clamp (v: float) = max (float fullLo) (min (float fullHi) v)
+
+                let ends =
+                    [ minOpt |> Option.map toRaw; maxOpt |> Option.map toRaw ]
+                    |> List.choose id
+
+                let lowEnd, highEnd =
+                    match minOpt, maxOpt with
+                    | Some _, Some _ -> List.min ends, List.max ends
+                    | Some _, None when s.Factor > 0.0 -> ends.Head, float fullHi
+                    | None, Some _ when s.Factor < 0.0 -> ends.Head, float fullHi
+                    | _ -> float fullLo, ends.Head
+
+                let lo0 = int64 (clamp (ceil lowEnd))
+                let hi0 = int64 (clamp (floor highEnd))
+
+                let rec inward (v: int64) (step: int64) (tries: int) =
+                    if tries = 0 || accepts v then v else inward (v + step) step (tries - 1)
+
+                let lo = if lo0 <= hi0 then inward lo0 1L 4 else lo0
+                let hi = if lo <= hi0 then inward hi0 -1L 4 else hi0
+
+                if lo <= hi && accepts lo && accepts hi then
+                    lo, uint64 hi - uint64 lo
+                else
+                    full
+
+        let private fillFunction (message: Message) (config: Signal.CANdy.Core.Config.Config) =
+            let switchOpt, _, branches = Message.partitionMultiplex message
+            let isMux = switchOpt.IsSome && not branches.IsEmpty
+
+            let crcSignal =
+                if message.CrcCounterMode = Some CrcCounterMode.Validate then
+                    message.Signals |> List.tryFind (fun s -> s.CrcMeta.IsSome)
+                else
+                    None
+
+            let draw (indent: string) (s: Signal) =
+                let (_, setFn) = Utils.accessorNames s.ByteOrder
+                let lo, span = rawRange s
+
+                sprintf
+                    "%s%s(data, %d, %d, bench_draw(rng, 0x%XULL, 0x%XULL)); /* %s */"
+                    indent
+                    setFn
+                    (Utils.chooseStartBit s config)
+                    (int s.Length)
+                    (uint64 lo)
+                    span
+                    s.Name
+
+            let isPlain (s: Signal) =
+                (not isMux || s.MultiplexerIndicator.IsNone)
+                && (crcSignal |> Option.forall (fun c -> c.Name <> s.Name))
+
+            let plain = message.Signals |> List.filter isPlain |> List.map (draw "    ")
+
+            let mux =
+                match switchOpt with
+                | Some sw when isMux ->
+                    let (_, setFn) = Utils.accessorNames sw.ByteOrder
+                    let values = branches |> List.map fst
+
+                    let cases =
+                        branches
+                        |> List.map (fun (v, signals) ->
+                            [ yield sprintf "        case %dULL:" v
+                              yield! signals |> List.map (draw "            ")
+                              yield "            break;" ]
+                            |> String.concat "\n")
+                        |> String.concat "\n"
+
+                    [ sprintf
+                          "    static const uint64_t sel_values[%d] = { %s };"
+                          values.Length
+                          (values |> List.map (sprintf "%dULL") |> String.concat ", ")
+                      sprintf "    uint64_t sel = sel_values[bench_next(rng) %% %du];" values.Length
+                      sprintf "    %s(data, %d, %d, sel);" setFn (Utils.chooseStartBit sw config) (int sw.Length)
+                      "    switch (sel) {"
+                      cases
+                      "        default:"
+                      "            break;"
+                      "    }" ]
+                | _ -> []
+
+            let crc =
+                match crcSignal with
+                | Some c ->
+                    let (_, setFn) = Utils.accessorNames c.ByteOrder
+
+                    [ sprintf
+                          "    %s(data, %d, %d, (uint64_t)%s);"
+                          setFn
+                          (Utils.chooseStartBit c config)
+                          (int c.Length)
+                          (Message.crcCall c.CrcMeta.Value) ]
+                | None -> []
+
+            [ yield sprintf "static void fill_%s(uint8_t data[], uint64_t* rng) {" message.Name
+              yield! plain
+              yield! mux
+              yield! crc
+              if plain.IsEmpty && mux.IsEmpty && crc.IsEmpty then
+                  yield "    (void)data;"
+                  yield "    (void)rng;"
+              yield "}" ]
+            |> String.concat "\n"
+
+        /// Benchmark driver for the harness (tools/<prefix>bench.c): randomized valid payloads per
+        /// message, timed decode/encode/roundtrip loops and registry dispatch, reported as JSON.
+        let generateBenchmark (ir: Ir) (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let toolsDir = Path.Combine(outputPath, "tools")
+            Directory.CreateDirectory(toolsDir) |> ignore
+            let path = Path.Combine(toolsDir, benchFileName config)
+
+            let configLine = configLine config
+            let banner = sprintf "/* Generated by Signal CANdy\n   %s */\n" configLine
+
+            let messages =
+                (Signal.CANdy.Core.Dbc.applyConfigMetadata (Some config) ir).Messages
+                |> List.distinctBy (fun m -> m.Id)
+
+            let includes =
+                messages
+                |> List.map (fun m -> sprintf "#include \"%s.h\"" (m.Name.ToLowerInvariant()))
+                |> String.concat "\n"
+
+            let messageUnion =
+                messages
+                |> List.map (fun m -> sprintf "    %s_t m_%s;" m.Name m.Name)
+                |> String.concat "\n"
+
+            let table =
+                messages
+                |> List.map (fun m ->
+                    sprintf
+                        "    { \"%s\", %du, %d, (bench_decode_fn)%s_decode, (bench_encode_fn)%s_encode, fill_%s }"
+                        m.Name
+                        (int m.Id)
+                        (int m.Length)
+                        m.Name
+                        m.Name
+                        m.Name)
+                |> String.concat ",\n"
+
+            let model: (string * obj) list =
+                [ "banner", box banner
+                  "tool_name", box (benchName config)
+                  "config_line", box configLine
+                  "utils_header_name", box (Utils.utilsHeaderName config)
+                  "registry_header_name", box (sprintf "%sregistry.h" config.FilePrefix)
+                  "message_includes", box includes
+                  "message_union", box messageUnion
+                  "fill_functions", box (messages |> List.map (fun m -> fillFunction m config) |> String.concat "\n\n")
+                  "message_table", box table ]
+
+            File.WriteAllText(path, Templates.renderOrRaise "bench.c.scriban" model)
+            path
+
+        /// Bit accessor suite for the harness (tools/<prefix>bit_accessors.c): get/set_bits_le/be swept
+        /// over every start bit, length and payload length against a reference model, then timed.
+        let generateAccessorSuite (outputPath: string) (config: Signal.CANdy.Core.Config.Config) =
+            let toolsDir = Path.Combine(outputPath, "tools")
+            Directory.CreateDirectory(toolsDir) |> ignore
+            let path = Path.Combine(toolsDir, accessorSuiteFileName config)
+            let configLine = configLine config
+
+            let model: (string * obj) list =
+                [ "banner", box (sprintf "/* Generated by Signal CANdy\n   %s */\n" configLine)
+                  "tool_name", box (accessorSuiteName config)
+                  "config_line", box configLine
+                  "utils_header_name", box (Utils.utilsHeaderName config)
+                  "utils_source_name", box (sprintf "%sutils.c" config.FilePrefix) ]
+
+            File.WriteAllText(path, Templates.renderOrRaise "bit_accessors.c.scriban" model)
+            path
+
+    // Compatibility shims for legacy includes (utils.h, registry.h)
+    let private shimHeader (name: string) (target: string) =
+        let guard = (name.Replace('.', '_') + "_SHIM").ToUpperInvariant()
+
+        "#ifndef "
+        + guard
+        + "\n#define "
+        + guard
+        + "\n\n"
+        + "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n"
+        + "#include \""
+        + target
+        + "\"\n\n"
+        + "#ifdef __cplusplus\n}\n#endif\n\n"
+        + "#endif // "
+        + guard
+
+    // Main entry: generate code and return file lists
+    let generate
+        (ir: Ir)
+        (outputPath: string)
+        (config: Signal.CANdy.Core.Config.Config)
+        : Result<GeneratedFiles, CodeGenError> =
+        try
+            // Ensure output directories
+            Directory.CreateDirectory(Path.Combine(outputPath, "include")) |> ignore
+
+            Directory.CreateDirectory(Path.Combine(outputPath, "src")) |> ignore
+
+            let overflowGuard =
+                ir.Messages
+                |> List.tryFind (fun msg ->
+                    let hasMuxSwitch =
+                        msg.Signals |> List.exists (fun s -> s.MultiplexerIndicator = Some "M")
+
+                    let hasMuxBranches =
+                        msg.Signals
+                        |> List.exists (fun s -> s.MultiplexerIndicator = Some "m" && s.MultiplexerSwitchValue.IsSome)
+
+                    hasMuxSwitch && hasMuxBranches && msg.Signals.Length > 1024)
+
+            match overflowGuard with
+            | Some msg ->
+                Error(
+                    CodeGenError.UnsupportedFeature(
+                        sprintf
+                            "Message '%s' has %d signals (>1024); valid bitmask cannot support more than 1024 signals."
+                            msg.Name
+                            msg.Signals.Length
+                    )
+                )
+            | None ->
+                let ir = Signal.CANdy.Core.Dbc.applyConfigMetadata (Some config) ir
+
+                let hasCrcValidateMode =
+                    match config.CrcCounter with
+                    | Some crcCfg when crcCfg.Mode = "validate" -> true
+                    | _ -> false
+
+                let crcCounterGuard =
+                    match config.CrcCounter with
+                    | Some crcCfg when crcCfg.Mode = "fail_fast" ->
+                        if crcCfg.Messages.IsEmpty then
+                            None
+                        else
+                            let firstMsg = crcCfg.Messages |> Map.toList |> List.head |> fst
+                            Some(firstMsg, "CRC/counter", None)
+                    | Some _ -> None
+                    | None ->
+                        if config.CrcCounterCheck then
+                            ir.Messages
+                            |> List.tryPick (fun msg ->
+                                msg.Signals
+                                |> List.tryFind (fun s -> s.IsCrc || s.IsCounter)
+                                |> Option.map (fun s ->
+                                    (msg.Name,
+                                     (if s.IsCrc then "CRC"
                                       elif s.IsCounter then "counter"
                                       else "CRC/counter"),
                                      Some s.Name)))
@@ -1176,12 +4170,30 @@ module Codegen =
                                 msg.Signals
                                 |> List.tryPick (fun s ->
                                     match s.CrcMeta with
-                                    | Some meta when meta.Params.Width <> 8 ->
+                                    | Some({ Algorithm = CrcAlgorithmId.Custom name } as meta) when meta.Params.Width <> 8 ->
+                                        Some(
+                                            sprintf
+                                                "CRC signal '%s' in message '%s' uses custom algorithm '%s' with width %d (custom algorithms must be CRC-8)."
+                                                s.Name
+                                                msg.Name
+                                                name
+                                                meta.Params.Width
+                                        )
+                                    | Some meta when not (List.contains meta.Params.Width [ 8; 16; 32 ]) ->
+                                        Some(
+                                            sprintf
+                                                "CRC signal '%s' in message '%s' has unsupported width %d (CRC-8, CRC-16 and CRC-32 are supported)."
+                                                s.Name
+                                                msg.Name
+                                                meta.Params.Width
+                                        )
+                                    | Some meta when int s.Length < meta.Params.Width ->
                                         Some(
                                             sprintf
-                                                "CRC signal '%s' in message '%s' has unsupported width %d (only CRC-8 is supported in this version)."
+                                                "CRC signal '%s' in message '%s' is %d bits wide but its algorithm produces %d bits."
                                                 s.Name
                                                 msg.Name
+                                                s.Length
                                                 meta.Params.Width
                                         )
                                     | _ -> None))
@@ -1251,18 +4263,266 @@ module Codegen =
                         // Messages
                         let msgFiles =
                             ir.Messages
-                            |> List.map (fun m -> Message.generateMessageFiles m outputPath config)
+                            |> List.mapi (fun i m -> Message.generateMessageFiles m i outputPath config)
                         // Registry
                         let regHPath, regCPath = Registry.generateRegistryFiles ir outputPath config
 
-                        let sources = msgFiles |> List.map snd |> (fun xs -> uCPath :: regCPath :: xs)
+                        // Optional feature files (subscriptions, TX scheduler, RX monitor, E2E supervisor, Arrow writer, SocketCan); drop stale output when disabled or re-prefixed
+                        let keepSubH =
+                            if config.Subscriptions then Some(Subscribe.subscribeHeaderName config) else None
+
+                        let keepSubC =
+                            if config.Subscriptions then Some(Subscribe.subscribeSourceName config) else None
+
+                        Directory.GetFiles(includeDir, "*subscribe.h")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepSubH then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        Directory.GetFiles(srcDir, "*subscribe.c")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepSubC then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        let keepTxH =
+                            if config.TxScheduler then Some(TxScheduler.schedulerHeaderName config) else None
+
+                        let keepTxC =
+                            if config.TxScheduler then Some(TxScheduler.schedulerSourceName config) else None
+
+                        Directory.GetFiles(includeDir, "*tx_scheduler.h")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepTxH then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        Directory.GetFiles(srcDir, "*tx_scheduler.c")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepTxC then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        let keepRxH =
+                            if config.RxMonitor then Some(RxMonitor.monitorHeaderName config) else None
+
+                        let keepRxC =
+                            if config.RxMonitor then Some(RxMonitor.monitorSourceName config) else None
+
+                        Directory.GetFiles(includeDir, "*rx_monitor.h")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepRxH then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        Directory.GetFiles(srcDir, "*rx_monitor.c")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepRxC then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        let keepE2eH =
+                            if config.E2eSupervisor then Some(E2eSupervisor.supervisorHeaderName config) else None
+
+                        let keepE2eC =
+                            if config.E2eSupervisor then Some(E2eSupervisor.supervisorSourceName config) else None
+
+                        Directory.GetFiles(includeDir, "*e2e_supervisor.h")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepE2eH then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        Directory.GetFiles(srcDir, "*e2e_supervisor.c")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepE2eC then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        let keepArrowH =
+                            if config.ArrowWriter then Some(ArrowWriter.writerHeaderName config) else None
+
+                        let keepArrowC =
+                            if config.ArrowWriter then Some(ArrowWriter.writerSourceName config) else None
+
+                        Directory.GetFiles(includeDir, "*arrow_writer.h")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepArrowH then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        Directory.GetFiles(srcDir, "*arrow_writer.c")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepArrowC then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        let keepCanH =
+                            if config.SocketCan then Some(SocketCan.adapterHeaderName config) else None
+
+                        let keepCanC =
+                            if config.SocketCan then Some(SocketCan.adapterSourceName config) else None
+
+                        Directory.GetFiles(includeDir, "*socketcan.h")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepCanH then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        Directory.GetFiles(srcDir, "*socketcan.c")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepCanC then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        let keepCppH =
+                            if config.CppHeader then Some(CppHeader.cppHeaderName config) else None
+
+                        Directory.GetFiles(includeDir, "*signals.hpp")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepCppH then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        let keepEngineH =
+                            if config.DescriptorBlob then Some(DescriptorBlob.engineHeaderName config) else None
+
+                        let keepEngineC =
+                            if config.DescriptorBlob then Some(DescriptorBlob.engineSourceName config) else None
+
+                        Directory.GetFiles(includeDir, "*dbc_engine.h")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepEngineH then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        Directory.GetFiles(srcDir, "*dbc_engine.c")
+                        |> Array.iter (fun f ->
+                            if Some(Path.GetFileName(f)) <> keepEngineC then
+                                try
+                                    File.Delete f
+                                with _ ->
+                                    ())
+
+                        // The blob sits in the output root next to user files, so only its own name is removed.
+                        if not config.DescriptorBlob then
+                            try
+                                File.Delete(Path.Combine(outputPath, DescriptorBlob.blobName config))
+                            with _ ->
+                                ()
+
+                        let keepLogTool =
+                            if config.LogDecoder then Some(LogDecoder.toolFileName config) else None
+
+                        let toolsDir = Path.Combine(outputPath, "tools")
+
+                        if Directory.Exists toolsDir then
+                            Directory.GetFiles(toolsDir, "*log_decode.c")
+                            |> Array.iter (fun f ->
+                                if Some(Path.GetFileName(f)) <> keepLogTool then
+                                    try
+                                        File.Delete f
+                                    with _ ->
+                                        ())
+
+                        let bpfDir = Path.Combine(outputPath, "bpf")
+
+                        if Directory.Exists bpfDir then
+                            let keepBpf =
+                                if config.EbpfSignals.IsEmpty then
+                                    []
+                                else
+                                    [ Ebpf.headerName config; Ebpf.programName config; Ebpf.userSourceName config ]
+
+                            [ "*can_bpf.h"; "*can_bpf.bpf.c"; "*can_bpf_user.c" ]
+                            |> List.collect (fun pattern -> Directory.GetFiles(bpfDir, pattern) |> Array.toList)
+                            |> List.iter (fun f ->
+                                if not (List.contains (Path.GetFileName(f)) keepBpf) then
+                                    try
+                                        File.Delete f
+                                    with _ ->
+                                        ())
+
+                        let bpfFiles =
+                            if config.EbpfSignals.IsEmpty then
+                                []
+                            else
+                                Ebpf.generateBpfFiles ir outputPath config
+
+                        let logTools =
+                            if config.LogDecoder then
+                                [ LogDecoder.generateLogDecoder ir outputPath config ]
+                            else
+                                []
+
+                        let descriptorFiles =
+                            if config.DescriptorBlob then
+                                [ DescriptorBlob.generateDescriptorFiles ir outputPath config ]
+                            else
+                                []
+
+                        let cppHeaders =
+                            if config.CppHeader then
+                                [ CppHeader.generateCppHeader ir outputPath config ]
+                            else
+                                []
+
+                        let optionalFiles =
+                            [ if config.Subscriptions then
+                                  Subscribe.generateSubscribeFiles ir outputPath config
+                              if config.TxScheduler then
+                                  TxScheduler.generateSchedulerFiles ir outputPath config
+                              if config.RxMonitor then
+                                  RxMonitor.generateMonitorFiles ir outputPath config
+                              if config.E2eSupervisor then
+                                  E2eSupervisor.generateSupervisorFiles ir outputPath config
+                              if config.ArrowWriter then
+                                  ArrowWriter.generateWriterFiles ir outputPath config
+                              if config.SocketCan then
+                                  SocketCan.generateAdapterFiles ir outputPath config ]
+                            @ (descriptorFiles |> List.map fst)
+
+                        let sources =
+                            (msgFiles |> List.map snd |> (fun xs -> uCPath :: regCPath :: xs))
+                            @ (optionalFiles |> List.map snd)
 
                         let headers =
-                            msgFiles
-                            |> List.map fst
-                            |> fun xs -> uHPath :: regHPath :: shimUtilsPath :: shimRegPath :: xs
+                            (msgFiles
+                             |> List.map fst
+                             |> fun xs -> uHPath :: regHPath :: shimUtilsPath :: shimRegPath :: xs)
+                            @ (optionalFiles |> List.map fst)
+                            @ cppHeaders
 
-                        let others: string list = []
+                        let others: string list = (descriptorFiles |> List.map snd) @ logTools @ bpfFiles
 
                         Ok
                             { Sources = sources
@@ -17,7 +17,8 @@ module Config =
     type CounterSignalConfig =
         { Signal: string
           Modulus: int
-          Increment: int }
+          Increment: int
+          MaxDelta: int }
 
     type CrcCounterMessageConfig =
         { Crc: CrcSignalConfig option
@@ -45,13 +46,28 @@ module Config =
           CrcCounterCheck: bool
           MotorolaStartBit: string
           FilePrefix: string
-          CrcCounter: CrcCounterConfig option }
+          CrcCounter: CrcCounterConfig option
+          RegistryCache: bool
+          Subscriptions: bool
+          TxScheduler: bool
+          RxMonitor: bool
+          RxTimeoutFactor: int
+          CrcPatch: bool
+          E2eSupervisor: bool
+          CppHeader: bool
+          CodegenStyle: string
+          DescriptorBlob: bool
+          LogDecoder: bool
+          ArrowWriter: bool
+          SocketCan: bool
+          EbpfSignals: string list }
 
     // --- Validation helpers ---
     let private validPhysTypes = [ "float"; "fixed" ]
     let private validPhysModes = [ "double"; "float"; "fixed_double"; "fixed_float" ]
     let private validDispatch = [ "binary_search"; "direct_map" ]
     let private validMoto = [ "msb"; "lsb" ]
+    let private validCodegenStyles = [ "unrolled"; "table" ]
     let private validCrcCounterModes = [ "validate"; "passthrough"; "fail_fast" ]
 
     let private builtinAlgorithmWidths =
@@ -96,12 +112,11 @@ module Config =
 
                                 match builtinWidth, customWidth with
                                 | None, None -> Some(UnknownAlgorithm crcSig.Algorithm)
-                                | Some width, _
-                                | _, Some width when width <> 8 ->
+                                | None, Some width when width <> 8 ->
                                     Some(
                                         ConfigConflict(
                                             sprintf
-                                                "CRC algorithm '%s' width must be 8 for MVP; CRC-16/32/64 not yet supported"
+                                                "custom CRC algorithm '%s' width must be 8; use CRC16_CCITT or CRC32P4 for CRC-16/32"
                                                 crcSig.Algorithm
                                         )
                                     )
@@ -112,6 +127,18 @@ module Config =
                         match msgCfg.Counter with
                         | Some counterSig when counterSig.Modulus < 2 ->
                             Some(InvalidModulus(msgName, counterSig.Modulus))
+                        | Some counterSig when
+                            counterSig.MaxDelta < 1
+                            || counterSig.MaxDelta * max 1 counterSig.Increment >= counterSig.Modulus
+                            ->
+                            Some(
+                                InvalidValue(
+                                    sprintf
+                                        "Counter max_delta %d in message '%s' must be at least 1 and max_delta * increment must stay below modulus"
+                                        counterSig.MaxDelta
+                                        msgName
+                                )
+                            )
                         | Some counterSig when String.IsNullOrWhiteSpace(counterSig.Signal) ->
                             Some(
                                 InvalidValue(
@@ -137,11 +164,67 @@ module Config =
             Error(ValidationError.InvalidValue(sprintf "Invalid motorola_start_bit '%s'" cfg.MotorolaStartBit))
         elif not (prefixRegex.IsMatch cfg.FilePrefix) then
             Error(ValidationError.InvalidValue(sprintf "Invalid file_prefix '%s'" cfg.FilePrefix))
+        elif not (List.contains (cfg.CodegenStyle.ToLowerInvariant()) validCodegenStyles) then
+            Error(ValidationError.InvalidValue(sprintf "Invalid codegen_style '%s'" cfg.CodegenStyle))
+        elif cfg.RxTimeoutFactor < 1 then
+            Error(ValidationError.InvalidValue(sprintf "Invalid rx_timeout_factor '%d' (must be >= 1)" cfg.RxTimeoutFactor))
+        elif cfg.EbpfSignals |> List.exists (fun s -> s.Split('.').Length <> 2 || s.StartsWith "." || s.EndsWith ".") then
+            let bad =
+                cfg.EbpfSignals
+                |> List.find (fun s -> s.Split('.').Length <> 2 || s.StartsWith "." || s.EndsWith ".")
+
+            Error(ValidationError.InvalidValue(sprintf "Invalid ebpf_signals entry '%s' (expected MESSAGE.SIGNAL)" bad))
         else
             match validateCrcCounter cfg with
             | Some err -> Error err
             | None -> Ok cfg
 
+    /// Cross-checks the config against parsed DBC messages: every ebpf_signals entry must name an
+    /// existing signal, and each CRC signal must be at least as wide as its algorithm (messages or
+    /// signals of the crc_counter block absent from the DBC are left alone).
+    let validateAgainstIr (cfg: Config) (ir: Signal.CANdy.Core.Ir.Ir) : Result<Config, ValidationError> =
+        let missingEbpf =
+            cfg.EbpfSignals
+            |> List.tryPick (fun entry ->
+                let parts = entry.Split('.')
+
+                match ir.Messages |> List.tryFind (fun m -> m.Name = parts.[0]) with
+                | None -> Some(MessageNotFound parts.[0])
+                | Some m when not (m.Signals |> List.exists (fun s -> s.Name = parts.[1])) ->
+                    Some(SignalNotFound(parts.[0], parts.[1]))
+                | Some _ -> None)
+
+        match missingEbpf, cfg.CrcCounter with
+        | Some err, _ -> Error err
+        | None, None -> Ok cfg
+        | None, Some crcCfg ->
+            let customAlgorithms = crcCfg.CustomAlgorithms |> Option.defaultValue Map.empty
+
+            let mismatch =
+                crcCfg.Messages
+                |> Map.toList
+                |> List.tryPick (fun (msgName, msgCfg) ->
+                    match msgCfg.Crc with
+                    | None -> None
+                    | Some crcSig ->
+                        let width =
+                            Map.tryFind crcSig.Algorithm builtinAlgorithmWidths
+                            |> Option.orElse (customAlgorithms |> Map.tryFind crcSig.Algorithm |> Option.map _.Width)
+
+                        let signalBits =
+                            ir.Messages
+                            |> List.tryFind (fun m -> m.Name = msgName)
+                            |> Option.bind (fun m -> m.Signals |> List.tryFind (fun s -> s.Name = crcSig.Signal))
+                            |> Option.map (fun s -> int s.Length)
+
+                        match width, signalBits with
+                        | Some w, Some bits when bits < w -> Some(CrcWidthMismatch(msgName, w, bits))
+                        | _ -> None)
+
+            match mismatch with
+            | Some err -> Error err
+            | None -> Ok cfg
+
     // --- YAML loading helpers ---
     let private tryGetString (map: IDictionary<string, obj>) (keys: string list) : string option =
         keys
@@ -258,6 +341,61 @@ module Config =
             let filePrefix =
                 tryGetString map [ "file_prefix"; "FilePrefix" ] |> Option.defaultValue "sc_"
 
+            let registryCache =
+                tryGetBool map [ "registry_cache"; "RegistryCache" ]
+                |> Option.defaultValue false
+
+            let subscriptions =
+                tryGetBool map [ "subscriptions"; "Subscriptions" ]
+                |> Option.defaultValue false
+
+            let txScheduler =
+                tryGetBool map [ "tx_scheduler"; "TxScheduler" ]
+                |> Option.defaultValue false
+
+            let rxMonitor =
+                tryGetBool map [ "rx_monitor"; "RxMonitor" ] |> Option.defaultValue false
+
+            let rxTimeoutFactor =
+                tryGetInt64 map [ "rx_timeout_factor"; "RxTimeoutFactor" ]
+                |> Option.map int
+                |> Option.defaultValue 3
+
+            let crcPatch =
+                tryGetBool map [ "crc_patch"; "CrcPatch" ] |> Option.defaultValue false
+
+            let e2eSupervisor =
+                tryGetBool map [ "e2e_supervisor"; "E2eSupervisor" ]
+                |> Option.defaultValue false
+
+            let cppHeader =
+                tryGetBool map [ "cpp_header"; "CppHeader" ] |> Option.defaultValue false
+
+            let codegenStyle =
+                tryGetString map [ "codegen_style"; "CodegenStyle" ]
+                |> Option.defaultValue "unrolled"
+
+            let descriptorBlob =
+                tryGetBool map [ "descriptor_blob"; "DescriptorBlob" ]
+                |> Option.defaultValue false
+
+            let logDecoder =
+                tryGetBool map [ "log_decoder"; "LogDecoder" ] |> Option.defaultValue false
+
+            let arrowWriter =
+                tryGetBool map [ "arrow_writer"; "ArrowWriter" ] |> Option.defaultValue false
+
+            let socketCan =
+                tryGetBool map [ "socketcan"; "SocketCan" ] |> Option.defaultValue false
+
+            let ebpfSignals =
+                [ "ebpf_signals"; "EbpfSignals" ]
+                |> List.tryPick (fun k ->
+                    match map.TryGetValue(k) with
+                    | true, (:? IList<obj> as items) -> Some [ for item in items -> string item ]
+                    | _ -> None)
+                |> Option.defaultValue []
+
             let crcCounter =
                 match map.TryGetValue("crc_counter") with
                 | true, v when not (isNull v) ->
@@ -431,10 +569,16 @@ module Config =
                                                             |> Option.map int
                                                             |> Option.defaultValue 1
 
+                                                        let maxDelta =
+                                                            tryGetInt64 counterMap [ "max_delta"; "maxDelta" ]
+                                                            |> Option.map int
+                                                            |> Option.defaultValue 1
+
                                                         Some
                                                             { Signal = signal
                                                               Modulus = modulus
-                                                              Increment = increment }
+                                                              Increment = increment
+                                                              MaxDelta = maxDelta }
                                                     | None -> None
                                                 | _ -> None
 
@@ -459,7 +603,21 @@ module Config =
                   CrcCounterCheck = crc
                   MotorolaStartBit = moto
                   FilePrefix = filePrefix
-                  CrcCounter = crcCounter }
+                  CrcCounter = crcCounter
+                  RegistryCache = registryCache
+                  Subscriptions = subscriptions
+                  TxScheduler = txScheduler
+                  RxMonitor = rxMonitor
+                  RxTimeoutFactor = rxTimeoutFactor
+                  CrcPatch = crcPatch
+                  E2eSupervisor = e2eSupervisor
+                  CppHeader = cppHeader
+                  CodegenStyle = codegenStyle
+                  DescriptorBlob = descriptorBlob
+                  LogDecoder = logDecoder
+                  ArrowWriter = arrowWriter
+                  SocketCan = socketCan
+                  EbpfSignals = ebpfSignals }
 
             validate cfg
         with ex ->
@@ -228,6 +228,38 @@ module Dbc =
         entries
         |> List.fold (fun acc (m, s, meta) -> acc |> Map.add (m, s) meta) Map.empty
 
+    // Receiving nodes listed after the unit string of SG_ lines; Vector__XXX means none.
+    let private tryBuildSignalReceiverMap (filePath: string) : Map<string * string, string list> =
+        let mutable currentMsg: string option = None
+        let mutable entries: (string * string * string list) list = []
+
+        for raw in File.ReadLines(filePath) do
+            let line = raw.Trim()
+
+            if line.StartsWith("BO_ ") then
+                let parts = line.Split([| ' '; ':' |], StringSplitOptions.RemoveEmptyEntries)
+
+                if parts.Length >= 3 then
+                    currentMsg <- Some parts.[2]
+            elif line.StartsWith("SG_") then
+                match currentMsg with
+                | None -> ()
+                | Some msgName ->
+                    let parts = line.Split([| ' ' |], StringSplitOptions.RemoveEmptyEntries)
+                    let quoteIdx = line.LastIndexOf('"')
+
+                    if parts.Length >= 2 && quoteIdx > 0 then
+                        let receivers =
+                            line.Substring(quoteIdx + 1).Split([| ','; ' '; '\t' |], StringSplitOptions.RemoveEmptyEntries)
+                            |> Array.filter (fun r -> r <> "Vector__XXX")
+                            |> Array.toList
+
+                        if not receivers.IsEmpty then
+                            entries <- (msgName, parts.[1], receivers) :: entries
+
+        entries
+        |> List.fold (fun acc (m, s, rs) -> acc |> Map.add (m, s) rs) Map.empty
+
     let private buildIdNameMap (filePath: string) : Map<int, string> =
         let mutable m: Map<int, string> = Map.empty
 
@@ -282,6 +314,46 @@ module Dbc =
 
         map
 
+    // GenMsgCycleTime / GenMsgStartDelayTime message attributes (BA_DEF_DEF_ defaults + per-message BA_).
+    // Returns a resolver by message ID; zero or missing values map to None.
+    let private tryBuildMessageTimingMap (filePath: string) : uint32 -> int option * int option =
+        let rxDefault =
+            Regex(@"^BA_DEF_DEF_\s+""(GenMsgCycleTime|GenMsgStartDelayTime)""\s+(\d+)\s*;")
+
+        let rxAttr =
+            Regex(@"^BA_\s+""(GenMsgCycleTime|GenMsgStartDelayTime)""\s+BO_\s+(\d+)\s+(\d+)\s*;")
+
+        let mutable defaults: Map<string, int> = Map.empty
+        let mutable perMessage: Map<uint32 * string, int> = Map.empty
+
+        for raw in File.ReadLines(filePath) do
+            let line = raw.Trim()
+            let d = rxDefault.Match(line)
+
+            if d.Success then
+                match Int32.TryParse(d.Groups.[2].Value) with
+                | true, v -> defaults <- defaults |> Map.add d.Groups.[1].Value v
+                | _ -> ()
+            else
+                let a = rxAttr.Match(line)
+
+                if a.Success then
+                    match UInt32.TryParse(a.Groups.[2].Value), Int32.TryParse(a.Groups.[3].Value) with
+                    | (true, id), (true, v) ->
+                        // Extended IDs carry bit 31 in the DBC text; match the parser's stripped ID.
+                        perMessage <- perMessage |> Map.add ((id &&& 0x7FFFFFFFu), a.Groups.[1].Value) v
+                    | _ -> ()
+
+        let resolve (id: uint32) (attr: string) =
+            let value =
+                match perMessage |> Map.tryFind (id, attr) with
+                | Some v -> Some v
+                | None -> defaults |> Map.tryFind attr
+
+            value |> Option.filter (fun v -> v > 0)
+
+        fun id -> resolve id "GenMsgCycleTime", resolve id "GenMsgStartDelayTime"
+
     /// Parse DBC file into Core IR with validation
     let parseDbcFile (filePath: string) : Result<Ir, ParseError> =
         try
@@ -291,6 +363,8 @@ module Dbc =
                 let metaMap = tryBuildSignalMetaMap filePath
                 let muxMap = tryBuildSignalMuxMap filePath
                 let valMap = tryBuildValueTableMap filePath
+                let receiverMap = tryBuildSignalReceiverMap filePath
+                let timingOf = tryBuildMessageTimingMap filePath
                 let dbc = DbcParserLib.Parser.ParseFromPath(filePath)
 
                 let messages =
@@ -339,19 +413,23 @@ module Dbc =
                                   MultiplexerIndicator = muxInd
                                   MultiplexerSwitchValue = muxVal
                                   ValueTable = (valMap |> Map.tryFind (msg.Name, s.Name))
-                                  Receivers = []
+                                  Receivers = (receiverMap |> Map.tryFind (msg.Name, s.Name) |> Option.defaultValue [])
                                   CrcMeta = None
                                   CounterMeta = None })
                             |> List.ofSeq
 
+                        let cycleTime, startDelay = timingOf msg.ID
+
                         { Name = msg.Name
                           Id = msg.ID
                           IsExtended = (msg.ID > 0x7FFu)
                           Length = msg.DLC
                           Signals = signals
                           Sender = msg.Transmitter
-                          Receivers = []
-                          CrcCounterMode = None })
+                          Receivers = signals |> List.collect (fun s -> s.Receivers) |> List.distinct
+                          CrcCounterMode = None
+                          CycleTimeMs = cycleTime
+                          StartDelayMs = startDelay })
                     |> List.ofSeq
 
                 let validateMuxStructure (msgs: Message list) : string option =
@@ -418,6 +496,22 @@ module Dbc =
                       XorOut = 0xFFUL
                       ReflectIn = false
                       ReflectOut = false }
+            | "CRC16_CCITT" ->
+                Some
+                    { Width = 16
+                      Poly = 0x1021UL
+                      Init = 0xFFFFUL
+                      XorOut = 0UL
+                      ReflectIn = false
+                      ReflectOut = false }
+            | "CRC32P4" ->
+                Some
+                    { Width = 32
+                      Poly = 0xF4ACFB13UL
+                      Init = 0xFFFFFFFFUL
+                      XorOut = 0xFFFFFFFFUL
+                      ReflectIn = true
+                      ReflectOut = true }
             | _ ->
                 crcCfg.CustomAlgorithms
                 |> Option.bind (Map.tryFind algorithm)
@@ -461,7 +555,8 @@ module Dbc =
                     CounterMeta =
                         Some
                             { Modulus = counterSig.Modulus
-                              Increment = counterSig.Increment } }
+                              Increment = counterSig.Increment
+                              MaxDelta = counterSig.MaxDelta } }
             | _ -> signalWithCrc
 
         match configOpt |> Option.bind (fun config -> config.CrcCounter) with
@@ -27,7 +27,10 @@ module Ir =
           ByteRange: {| Start: int; End: int |}
           DataId: uint16 option }
 
-    type CounterSignalMeta = { Modulus: int; Increment: int }
+    type CounterSignalMeta =
+        { Modulus: int
+          Increment: int
+          MaxDelta: int }
 
     type CrcCounterMode =
         | Validate
@@ -62,6 +65,8 @@ module Ir =
           Signals: Signal list
           Sender: string
           Receivers: string list
-          CrcCounterMode: CrcCounterMode option }
+          CrcCounterMode: CrcCounterMode option
+          CycleTimeMs: int option
+          StartDelayMs: int option }
 
     type Ir = { Messages: Message list }
@@ -236,6 +236,57 @@ crc_counter:
             if Directory.Exists(outDir) then
                 Directory.Delete(outDir, true)
 
+    [<Fact>]
+    let ``generateBenchmarkFromPaths fills validated CRC signals from the configured byte range`` () =
+        let dbcContent =
+            """
+VERSION ""
+NS_ :
+BS_:
+
+BO_ 200 TEST_MSG: 8 Vector__XXX
+ SG_ PAYLOAD : 0|8@1+ (1,0) [0|255] "" Vector__XXX
+ SG_ CHECKSUM : 8|8@1+ (1,0) [0|255] "" Vector__XXX
+"""
+
+        let configContent =
+            """
+crc_counter_check: true
+crc_counter:
+  mode: validate
+  messages:
+    TEST_MSG:
+      crc:
+        signal: CHECKSUM
+        algorithm: CRC8_SAE_J1850
+        byte_range:
+          start: 0
+          end: 0
+"""
+
+        let dbcPath = createTempFile dbcContent ".dbc"
+        let configPath = createTempFile configContent ".yaml"
+        let outDir = Path.Combine(Path.GetTempPath(), System.Guid.NewGuid().ToString())
+        Directory.CreateDirectory(outDir) |> ignore
+
+        try
+            let t = Signal.CANdy.Core.Api.generateBenchmarkFromPaths dbcPath outDir (Some configPath)
+
+            match t.GetAwaiter().GetResult() with
+            | Ok paths ->
+                paths |> List.map Path.GetFileName |> should equal [ "sc_bench.c"; "sc_bit_accessors.c" ]
+                let content = File.ReadAllText(paths.Head)
+                content |> should haveSubstring "set_bits_le(data, 0, 8, bench_draw(rng, 0x0ULL, 0xFFULL)); /* PAYLOAD */"
+                content |> should haveSubstring "set_bits_le(data, 8, 8, (uint64_t)sc_crc8_sae_j1850(&data[0], 1));"
+                content |> should not' (haveSubstring "/* CHECKSUM */")
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(dbcPath)
+            File.Delete(configPath)
+
+            if Directory.Exists(outDir) then
+                Directory.Delete(outDir, true)
+
     [<Fact>]
     let ``generateFromPaths returns Validation UnknownAlgorithm for CRC validate mode with unknown algorithm`` () =
         let dbcContent =
@@ -20,7 +20,21 @@ module CodegenTests =
           CrcCounterCheck = false
           MotorolaStartBit = "msb"
           FilePrefix = "sc_"
-          CrcCounter = None }
+          CrcCounter = None
+          RegistryCache = false
+          Subscriptions = false
+          TxScheduler = false
+          RxMonitor = false
+          RxTimeoutFactor = 3
+          CrcPatch = false
+          E2eSupervisor = false
+          CppHeader = false
+          CodegenStyle = "unrolled"
+          DescriptorBlob = false
+          LogDecoder = false
+          ArrowWriter = false
+          SocketCan = false
+          EbpfSignals = [] }
 
     /// A minimal single-signal for building test IR
     let private mkSignal name startBit length =
@@ -53,7 +67,9 @@ module CodegenTests =
                 Signals = [ mkSignal "Signal_1" 0us 8us; mkSignal "Signal_2" 8us 16us ]
                 Sender = "ECU"
                 Receivers = []
-                CrcCounterMode = None } ] }
+                CrcCounterMode = None
+                CycleTimeMs = None
+                StartDelayMs = None } ] }
 
     /// Helper: create temp output directory
     let private createTempOutDir () =
@@ -138,7 +154,9 @@ module CodegenTests =
                         MultiplexerSwitchValue = Some 2 } ]
                 Sender = "ECU"
                 Receivers = []
-                CrcCounterMode = None } ] }
+                CrcCounterMode = None
+                CycleTimeMs = None
+                StartDelayMs = None } ] }
 
     let private valueTableMuxIr =
         { Messages =
@@ -159,7 +177,9 @@ module CodegenTests =
                     mkSignalWithValueTable "Error" 24us 8us (Some "m") (Some 1) (Some [ 0, "OK"; 1, "WARN"; 2, "FAIL" ]) ]
                 Sender = "ECU"
                 Receivers = []
-                CrcCounterMode = None } ] }
+                CrcCounterMode = None
+                CycleTimeMs = None
+                StartDelayMs = None } ] }
 
     let private crcSignalIr =
         { Messages =
@@ -175,7 +195,9 @@ module CodegenTests =
                         CounterMeta = None } ]
                 Sender = "ECU"
                 Receivers = []
-                CrcCounterMode = None } ] }
+                CrcCounterMode = None
+                CycleTimeMs = None
+                StartDelayMs = None } ] }
 
     let private mkCrcCounterConfig mode messageName crcCfg counterCfg : CrcCounterConfig =
         { Mode = mode
@@ -198,6 +220,22 @@ module CodegenTests =
           ReflectIn = false
           ReflectOut = false }
 
+    let private mkCrc16CcittParams: CrcAlgorithmParams =
+        { Width = 16
+          Poly = 0x1021UL
+          Init = 0xFFFFUL
+          XorOut = 0UL
+          ReflectIn = false
+          ReflectOut = false }
+
+    let private mkCrc32P4Params: CrcAlgorithmParams =
+        { Width = 32
+          Poly = 0xF4ACFB13UL
+          Init = 0xFFFFFFFFUL
+          XorOut = 0xFFFFFFFFUL
+          ReflectIn = true
+          ReflectOut = true }
+
     let private mkCrcSignalMeta algorithm parameters byteStart byteEnd : CrcSignalMeta =
         { Algorithm = algorithm
           Params = parameters
@@ -306,7 +344,9 @@ module CodegenTests =
                             Offset = 0.0 } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         try
             match generate ir outDir fixedConfig with
@@ -338,6 +378,608 @@ module CodegenTests =
         finally
             cleanupDir outDir
 
+    [<Fact>]
+    let ``generate emits SC_PROF hooks with one stats slot per message`` () =
+        let outDir = createTempOutDir ()
+
+        let second =
+            { singleMessageIr.Messages.Head with
+                Name = "MESSAGE_2"
+                Id = 200u }
+
+        let ir = { Messages = singleMessageIr.Messages @ [ second ] }
+
+        let directMapConfig =
+            { defaultConfig with
+                Dispatch = "direct_map" }
+
+        try
+            match generate ir outDir directMapConfig with
+            | Ok files ->
+                let read name =
+                    files.Sources @ files.Headers
+                    |> List.find (fun f -> Path.GetFileName(f) = name)
+                    |> File.ReadAllText
+
+                let msg2 = read "message_2.c"
+                msg2 |> should haveSubstring "SC_PROF_BEGIN(1, decode);"
+                msg2 |> should haveSubstring "if (dlc < 8) { SC_PROF_FAIL(1, length); return false; }"
+                msg2 |> should haveSubstring "SC_PROF_END(1, decode);"
+                msg2 |> should haveSubstring "SC_PROF_BEGIN(1, encode);"
+                msg2 |> should haveSubstring "SC_PROF_END(1, encode);"
+
+                let regC = read "sc_registry.c"
+                regC |> should haveSubstring "default: SC_PROF_UNKNOWN_ID(); return false;"
+                regC |> should haveSubstring "    { .id = 100u, .name = \"MESSAGE_1\" },\n    { .id = 200u, .name = \"MESSAGE_2\" }"
+                regC |> should haveSubstring "size_t sc_prof_format_json(char* buf, size_t size) {"
+
+                let utilsH = read "sc_utils.h"
+                utilsH |> should haveSubstring "#define SC_PROF_MESSAGE_COUNT 2"
+                utilsH |> should haveSubstring "#define SC_PROF_BEGIN(slot, op) ((void)0)"
+                read "sc_registry.h" |> should haveSubstring "const sc_prof_stats_t* sc_prof_get(size_t* count);"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with registry_cache emits cached decode API`` () =
+        let outDir = createTempOutDir ()
+
+        let cacheConfig =
+            { defaultConfig with
+                RegistryCache = true }
+
+        try
+            match generate singleMessageIr outDir cacheConfig with
+            | Ok files ->
+                let regH =
+                    files.Headers |> List.find (fun f -> Path.GetFileName(f) = "sc_registry.h")
+
+                let regC =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_registry.c")
+
+                let header = File.ReadAllText(regH)
+                let content = File.ReadAllText(regC)
+                header |> should haveSubstring "decode_cache_result_t decode_message_cached("
+                header |> should haveSubstring "void decode_cache_reset(void);"
+                content |> should haveSubstring "static uint8_t cache_payload_MESSAGE_1[8];"
+                content |> should haveSubstring "(cache_decode_func_t)MESSAGE_1_decode, 8u, sizeof(MESSAGE_1_t)"
+                content |> should haveSubstring "return DECODE_CACHE_UNCHANGED;"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate without registry_cache omits cached decode API`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            match generate singleMessageIr outDir defaultConfig with
+            | Ok files ->
+                let regC =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_registry.c")
+
+                let content = File.ReadAllText(regC)
+                content |> should not' (haveSubstring "decode_message_cached")
+                content |> should not' (haveSubstring "#include <string.h>")
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with subscriptions emits payload masks and partial decode`` () =
+        let outDir = createTempOutDir ()
+
+        let subConfig =
+            { defaultConfig with
+                Subscriptions = true }
+
+        try
+            match generate singleMessageIr outDir subConfig with
+            | Ok files ->
+                let subH =
+                    files.Headers |> List.find (fun f -> Path.GetFileName(f) = "sc_subscribe.h")
+
+                let subC =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_subscribe.c")
+
+                let header = File.ReadAllText(subH)
+                let content = File.ReadAllText(subC)
+                header |> should haveSubstring "#define MESSAGE_1_SIG_SIGNAL_2 1u"
+                header |> should haveSubstring "int dispatch_frame(uint32_t id, const uint8_t data[], uint8_t dlc);"
+                content |> should haveSubstring "0x00000000000000FFULL, /* Signal_1 */"
+                content |> should haveSubstring "0x0000000000FFFF00ULL, /* Signal_2 */"
+                content |> should haveSubstring "case MESSAGE_1_SIG_SIGNAL_2: {"
+                content |> should not' (haveSubstring "MESSAGE_1_decode(")
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``subscriptions on multiplexed message keep switch bits out of branch masks`` () =
+        let outDir = createTempOutDir ()
+
+        let subConfig =
+            { defaultConfig with
+                Subscriptions = true }
+
+        try
+            match generate muxMessageIr outDir subConfig with
+            | Ok files ->
+                let subC =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_subscribe.c")
+
+                let content = File.ReadAllText(subC)
+                content |> should haveSubstring "0x0000000000FF0000ULL, /* Sig_m1 */"
+                content |> should haveSubstring "static const uint64_t sub_switch_MUX_MSG[] = { 0x000000000000000FULL };"
+                content |> should haveSubstring "0x0000000000000001ULL, /* Sig_m1 */"
+                content |> should haveSubstring "0x000000000000FF00ULL, /* Base_8 */"
+                content |> should haveSubstring "if (!MUX_MSG_decode(&tmp, data, dlc)) { return false; }"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate without subscriptions removes stale subscribe files`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            generate singleMessageIr outDir { defaultConfig with Subscriptions = true }
+            |> Result.isOk
+            |> should be True
+
+            match generate singleMessageIr outDir defaultConfig with
+            | Ok files ->
+                files.Sources
+                |> List.exists (fun f -> Path.GetFileName(f) = "sc_subscribe.c")
+                |> should be False
+
+                File.Exists(Path.Combine(outDir, "src", "sc_subscribe.c")) |> should be False
+                File.Exists(Path.Combine(outDir, "include", "sc_subscribe.h")) |> should be False
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with tx_scheduler places periodic messages on the timing wheel`` () =
+        let outDir = createTempOutDir ()
+
+        let periodicIr =
+            { Messages =
+                [ { singleMessageIr.Messages.Head with
+                      CycleTimeMs = Some 10 }
+                  { singleMessageIr.Messages.Head with
+                      Name = "SLOW_MSG"
+                      Id = 50u
+                      CycleTimeMs = Some 1000
+                      StartDelayMs = Some 20 }
+                  { singleMessageIr.Messages.Head with
+                      Name = "EVENT_MSG"
+                      Id = 300u } ] }
+
+        let txConfig =
+            { defaultConfig with
+                TxScheduler = true }
+
+        try
+            match generate periodicIr outDir txConfig with
+            | Ok files ->
+                let txH =
+                    files.Headers |> List.find (fun f -> Path.GetFileName(f) = "sc_tx_scheduler.h")
+
+                let txC =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_tx_scheduler.c")
+
+                let header = File.ReadAllText(txH)
+                let content = File.ReadAllText(txC)
+                header |> should haveSubstring "#define TX_SCHEDULER_TICK_MS 10u"
+                header |> should haveSubstring "#define TX_SCHEDULER_MESSAGE_COUNT 2"
+                header |> should haveSubstring "bool tx_scheduler_next_deadline(uint32_t* out_ms);"
+                content |> should haveSubstring "{ 50u, (tx_encode_func_t)SLOW_MSG_encode, 100u, 2u,"
+                content |> should haveSubstring "{ 100u, (tx_encode_func_t)MESSAGE_1_encode, 1u, 0u,"
+                content |> should haveSubstring "#define TX_WHEEL_SLOTS 128u"
+                content |> should haveSubstring "if (!tx_started || (int32_t)(now_ms - tx_cursor_ms) < 0) { return 0; }"
+                content |> should not' (haveSubstring "EVENT_MSG")
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with rx_monitor scales cycle times by rx_timeout_factor`` () =
+        let outDir = createTempOutDir ()
+
+        let cyclicIr =
+            { Messages =
+                [ { singleMessageIr.Messages.Head with
+                      CycleTimeMs = Some 10 }
+                  { singleMessageIr.Messages.Head with
+                      Name = "SLOW_MSG"
+                      Id = 50u
+                      CycleTimeMs = Some 100 }
+                  { singleMessageIr.Messages.Head with
+                      Name = "EVENT_MSG"
+                      Id = 300u } ] }
+
+        let rxConfig =
+            { defaultConfig with
+                RxMonitor = true
+                RxTimeoutFactor = 2 }
+
+        try
+            match generate cyclicIr outDir rxConfig with
+            | Ok files ->
+                let rxH =
+                    files.Headers |> List.find (fun f -> Path.GetFileName(f) = "sc_rx_monitor.h")
+
+                let rxC =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_rx_monitor.c")
+
+                let header = File.ReadAllText(rxH)
+                let content = File.ReadAllText(rxC)
+                header |> should haveSubstring "#define RX_MONITOR_TICK_MS 20u"
+                header |> should haveSubstring "#define RX_MONITOR_BIT_SLOW_MSG 0"
+                header |> should haveSubstring "#define RX_MONITOR_BIT_MESSAGE_1 1"
+                header |> should haveSubstring "#define RX_MONITOR_BITMAP_WORDS 1"
+                content |> should haveSubstring "{ 50u, 10u, 0u, -1, -1, false, true }, /* SLOW_MSG: 200 ms */"
+                content |> should haveSubstring "{ 100u, 1u, 0u, -1, -1, false, true }, /* MESSAGE_1: 20 ms */"
+                content |> should not' (haveSubstring "EVENT_MSG")
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with cpp_header emits constexpr signal descriptors and switch visit`` () =
+        let outDir = createTempOutDir ()
+
+        let beSignal =
+            { (mkSignal "TEMP" 7us 12us) with
+                ByteOrder = ByteOrder.Big
+                IsSigned = true
+                Factor = 0.5
+                Offset = -40.0 }
+
+        let ir =
+            { Messages =
+                [ { singleMessageIr.Messages.Head with
+                      Signals = singleMessageIr.Messages.Head.Signals @ [ beSignal ] } ] }
+
+        try
+            match generate ir outDir { defaultConfig with CppHeader = true } with
+            | Ok files ->
+                let hpp =
+                    files.Headers |> List.find (fun f -> Path.GetFileName(f) = "sc_signals.hpp")
+
+                let content = File.ReadAllText(hpp)
+                content |> should haveSubstring "struct MESSAGE_1 {"
+                content |> should haveSubstring "static constexpr std::uint32_t id = 100u;"
+                content |> should haveSubstring "struct TEMP : bits<7, 12, byte_order::big, true> {"
+                content |> should haveSubstring "static constexpr double offset = -40;"
+                content |> should haveSubstring "static constexpr std::size_t min_bytes = 2;"
+                content |> should haveSubstring "case 100u: f(msg::MESSAGE_1{}); return true;"
+                files.Sources |> List.exists (fun f -> f.EndsWith ".hpp") |> should equal false
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with descriptor_blob emits versioned blob and runtime engine`` () =
+        let outDir = createTempOutDir ()
+
+        let valueSignal =
+            { (mkSignal "Gear" 24us 4us) with
+                ValueTable = Some [ (0, "P"); (1, "D") ] }
+
+        let ir =
+            { Messages =
+                [ { singleMessageIr.Messages.Head with
+                      Signals = singleMessageIr.Messages.Head.Signals @ [ valueSignal ] } ] }
+
+        try
+            match generate ir outDir { defaultConfig with DescriptorBlob = true } with
+            | Ok files ->
+                let blobPath = files.Others |> List.exactlyOne
+                Path.GetFileName(blobPath) |> should equal "sc_dbc.bin"
+                files.Headers |> List.exists (fun f -> Path.GetFileName(f) = "sc_dbc_engine.h") |> should equal true
+                files.Sources |> List.exists (fun f -> Path.GetFileName(f) = "sc_dbc_engine.c") |> should equal true
+
+                let blob = File.ReadAllBytes(blobPath)
+                let u32 offset = System.BitConverter.ToUInt32(blob, offset)
+                u32 0 |> should equal 0x42444353u
+                System.BitConverter.ToUInt16(blob, 4) |> should equal 1us
+                u32 8 |> should equal (uint32 blob.Length)
+                u32 16 |> should equal 1u
+                u32 24 |> should equal 3u
+                u32 40 |> should equal 2u
+
+                // Third signal record: start bit, length and value-table slice
+                let gear = int (u32 28) + 2 * 64
+                System.BitConverter.ToUInt16(blob, gear + 40) |> should equal 24us
+                System.BitConverter.ToUInt16(blob, gear + 42) |> should equal 4us
+                System.BitConverter.ToUInt16(blob, gear + 46) |> should equal 2us
+
+                let strings = System.Text.Encoding.UTF8.GetString(blob, int (u32 52), int (u32 48))
+                strings |> should haveSubstring "MESSAGE_1\000"
+                strings |> should haveSubstring "Gear\000"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate without descriptor_blob removes stale blob and engine`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            generate singleMessageIr outDir { defaultConfig with DescriptorBlob = true } |> ignore
+            File.WriteAllText(Path.Combine(outDir, "vehicle_dbc.bin"), "user data")
+
+            match generate singleMessageIr outDir defaultConfig with
+            | Ok files ->
+                files.Others |> should be Empty
+                File.Exists(Path.Combine(outDir, "sc_dbc.bin")) |> should equal false
+                File.Exists(Path.Combine(outDir, "vehicle_dbc.bin")) |> should equal true
+                File.Exists(Path.Combine(outDir, "src", "sc_dbc_engine.c")) |> should equal false
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with arrow_writer emits column writer with nullable mux branches`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            match generate muxMessageIr outDir { defaultConfig with ArrowWriter = true } with
+            | Ok files ->
+                files.Headers |> List.exists (fun f -> Path.GetFileName(f) = "sc_arrow_writer.h") |> should equal true
+
+                let writer =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_arrow_writer.c")
+
+                let content = File.ReadAllText(writer)
+                content |> should haveSubstring "static const uint8_t aw_nullable_MUX_MSG[5] = { 0, 0, 0, 1, 1 };"
+                content |> should haveSubstring "static const uint8_t aw_widths_MUX_MSG[5] = { 8, 4, 4, 4, 4 };"
+                content |> should haveSubstring "AW_COLUMN(t, 2, int32_t)[r] = (int32_t)m->Base_8;"
+
+                content
+                |> should
+                    haveSubstring
+                    "if (m->valid & MUX_MSG_VALID_SIG_M1) { AW_COLUMN(t, 3, int32_t)[r] = (int32_t)m->Sig_m1; aw_set_valid(t, 3, r); }"
+
+                content |> should haveSubstring "case 200u: return 0;"
+                // Schema message starts with the IPC continuation marker
+                content |> should haveSubstring "static const uint8_t aw_schema_MUX_MSG["
+                content |> should haveSubstring "    0xFF, 0xFF, 0xFF, 0xFF,"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with socketcan emits Linux-guarded recvmmsg adapter`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            match generate singleMessageIr outDir { defaultConfig with SocketCan = true } with
+            | Ok files ->
+                files.Headers |> List.exists (fun f -> Path.GetFileName(f) = "sc_socketcan.h") |> should equal true
+
+                let adapter =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_socketcan.c")
+
+                let content = File.ReadAllText(adapter)
+                content |> should haveSubstring "#ifdef __linux__"
+                content |> should haveSubstring "#include \"message_1.h\""
+                content |> should haveSubstring "    MESSAGE_1_t m_MESSAGE_1;"
+                content |> should haveSubstring "recvmmsg(ch->fd, ch->msgs, SOCKETCAN_BATCH, MSG_DONTWAIT, NULL)"
+                content |> should haveSubstring "decode_message(rx.id, frame->data, rx.len, &msg)"
+                content |> should haveSubstring "sendmmsg(ch->fd, &ch->tx_msgs[ch->tx_head], pending, MSG_DONTWAIT)"
+                content |> should haveSubstring "    { 0x064u, 0x7FFu | CAN_EFF_FLAG | CAN_RTR_FLAG },"
+                content |> should haveSubstring "    { sc_filter_all, sizeof(sc_filter_all) / sizeof(sc_filter_all[0]) },"
+                content |> should haveSubstring "        case 0x64u:\n            if (!MESSAGE_1_encode(frame->data, &len, (const MESSAGE_1_t*)msg)) return false;\n            break;"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+
+            match generate singleMessageIr outDir defaultConfig with
+            | Ok _ -> File.Exists(Path.Combine(outDir, "src", "sc_socketcan.c")) |> should equal false
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``socketcan mergeFilters covers exactly the given IDs with merged masks`` () =
+        let ids = [ 0x100u .. 0x10Fu ] @ [ 0x200u; 0x201u; 0x203u; 0x7FFu ]
+        let filters = SocketCan.mergeFilters 11 ids
+        filters |> should equal [ (0x100u, 0x7F0u); (0x200u, 0x7FEu); (0x201u, 0x7FDu); (0x7FFu, 0x7FFu) ]
+
+        for id in 0u .. 0x7FFu do
+            filters
+            |> List.exists (fun (v, mask) -> id &&& mask = v)
+            |> should equal (List.contains id ids)
+
+        SocketCan.mergeFilters 29 [] |> should equal List.empty<uint32 * uint32>
+
+    [<Fact>]
+    let ``socketcan mergeFilters falls back to aligned blocks for large ID sets`` () =
+        // Dense 29-bit range: one block for the aligned 1024, then the unaligned tail.
+        let ids = [ 0x18000000u .. 0x18000402u ]
+        let filters = SocketCan.mergeFilters 29 ids
+
+        filters
+        |> should equal [ (0x18000000u, 0x1FFFFC00u); (0x18000400u, 0x1FFFFFFEu); (0x18000402u, 0x1FFFFFFFu) ]
+
+        let sparse = [ for i in 0u .. 299u -> i * 6u ]
+        let sparseFilters = SocketCan.mergeFilters 11 sparse
+        sparseFilters.Length |> should equal 300
+
+        for id in 0u .. 0x7FFu do
+            sparseFilters
+            |> List.exists (fun (v, mask) -> id &&& mask = v)
+            |> should equal (List.contains id sparse)
+
+    [<Fact>]
+    let ``generate with ebpf_signals emits socket filter program and loader`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            let config = { defaultConfig with EbpfSignals = [ "MESSAGE_1.Signal_2" ] }
+
+            match generate singleMessageIr outDir config with
+            | Ok files ->
+                let bpfDir = Path.Combine(outDir, "bpf")
+
+                files.Others
+                |> should equal
+                    [ Path.Combine(bpfDir, "sc_can_bpf.h")
+                      Path.Combine(bpfDir, "sc_can_bpf.bpf.c")
+                      Path.Combine(bpfDir, "sc_can_bpf_user.c") ]
+
+                let program = File.ReadAllText(Path.Combine(bpfDir, "sc_can_bpf.bpf.c"))
+                program |> should haveSubstring "SEC(\"socket\")"
+                program |> should haveSubstring "bpf_skb_load_bytes(skb, CB_DATA_OFFSET + 1, b, sizeof(b))"
+                program |> should haveSubstring "    raw |= (__u64)((b[0] >> 0) & 0xFFu) << 0;\n    raw |= (__u64)((b[1] >> 0) & 0xFFu) << 8;"
+                program |> should haveSubstring "cb_update(CAN_BPF_MESSAGE_1_SIGNAL_2, raw, 0, now);"
+
+                File.ReadAllText(Path.Combine(bpfDir, "sc_can_bpf_user.c"))
+                |> should haveSubstring "{ \"MESSAGE_1\", \"Signal_2\", 0x064u, false, "
+                program |> should haveSubstring "        case 0x064u:\n            cb_msg_MESSAGE_1(skb, len, now);"
+
+                File.ReadAllText(Path.Combine(bpfDir, "sc_can_bpf.h"))
+                |> should haveSubstring "#define CAN_BPF_SIGNAL_COUNT 1"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+
+            match generate singleMessageIr outDir defaultConfig with
+            | Ok _ -> File.Exists(Path.Combine(outDir, "bpf", "sc_can_bpf.bpf.c")) |> should equal false
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``ebpf bitRuns follow get_bits_be for Motorola signals`` () =
+        let signal =
+            { mkSignal "Yaw" 39us 13us with
+                ByteOrder = ByteOrder.Big }
+
+        Ebpf.bitRuns signal defaultConfig |> should equal [ (5, 3, 5, 0); (4, 0, 8, 5) ]
+
+    [<Fact>]
+    let ``ebpf bitRuns place every raw bit like the DBC layout for all 8-byte fields`` () =
+        // Reference: Intel runs upwards from the start bit; Motorola starts at the MSB and runs
+        // down, continuing at bit 7 of the next byte.
+        let reference (be: bool) (start: int) (length: int) =
+            let walk = List.scan (fun p _ -> if not be then p + 1 elif p % 8 = 0 then p + 15 else p - 1) start [ 1 .. length - 1 ]
+            if be then List.rev walk else walk
+
+        for be in [ false; true ] do
+            for start in 0..63 do
+                for length in 1..64 do
+                    let expected = reference be start length
+
+                    if List.max expected < 64 then
+                        let signal =
+                            { mkSignal "S" (uint16 start) (uint16 length) with
+                                ByteOrder = if be then ByteOrder.Big else ByteOrder.Little }
+
+                        let placed =
+                            Ebpf.bitRuns signal defaultConfig
+                            |> List.collect (fun (b, low, count, shift) ->
+                                [ for k in 0 .. count - 1 -> shift + k, b * 8 + low + k ])
+                            |> List.sortBy fst
+                            |> List.map snd
+
+                        if placed <> expected then
+                            failwithf "be=%b start=%d length=%d: %A <> %A" be start length placed expected
+
+    [<Fact>]
+    let ``generate with log_decoder emits log tool outside src with per-signal writers`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            match generate singleMessageIr outDir { defaultConfig with LogDecoder = true } with
+            | Ok files ->
+                let tool = files.Others |> List.exactlyOne
+                tool |> should equal (Path.Combine(outDir, "tools", "sc_log_decode.c"))
+                files.Sources |> List.exists (fun f -> f.Contains "log_decode") |> should equal false
+
+                let content = File.ReadAllText(tool)
+                content |> should haveSubstring "#include \"sc_registry.h\""
+                content |> should haveSubstring "OUT_SIGNAL(o, f, \"0x64,MESSAGE_1,Signal_2,\", 1, m->Signal_2);"
+                content |> should haveSubstring "case 100u: emit_MESSAGE_1(o, f, &m->m_MESSAGE_1); break;"
+                content |> should haveSubstring "\"0x64,MESSAGE_1,1,Signal_2,\\n\""
+                content |> should haveSubstring "decode_message(frame.id, frame.data, frame.len, &msg)"
+                content |> should haveSubstring "static bool decode_parallel("
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generateBenchmark writes a driver that fills and times every message`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            let path = Bench.generateBenchmark muxMessageIr outDir defaultConfig
+            path |> should equal (Path.Combine(outDir, "tools", "sc_bench.c"))
+
+            let content = File.ReadAllText(path)
+            content |> should haveSubstring "#include \"mux_msg.h\""
+            content |> should haveSubstring "set_bits_le(data, 8, 8, bench_draw(rng, 0x0ULL, 0xFFULL)); /* Base_8 */"
+            content |> should haveSubstring "static const uint64_t sel_values[2] = { 1ULL, 2ULL };"
+            content |> should haveSubstring "set_bits_le(data, 16, 16, bench_draw(rng, 0x0ULL, 0xFFFFULL)); /* Sig_m2 */"
+            content |> should haveSubstring "{ \"MUX_MSG\", 200u, 8, (bench_decode_fn)MUX_MSG_decode, (bench_encode_fn)MUX_MSG_encode, fill_MUX_MSG }"
+            content |> should haveSubstring "decode_message(f->id, f->data, f->len, m)"
+            // Baseline comparison tells a report from another configuration apart
+            content |> should haveSubstring "const char* const now[4] = { \"file_prefix=sc_, "
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generateAccessorSuite sweeps the generated accessors against a reference model`` () =
+        let outDir = createTempOutDir ()
+
+        try
+            let path = Bench.generateAccessorSuite outDir { defaultConfig with FilePrefix = "x_" }
+            path |> should equal (Path.Combine(outDir, "tools", "x_bit_accessors.c"))
+
+            let content = File.ReadAllText(path)
+            content |> should haveSubstring "#include \"x_utils.h\""
+            content |> should haveSubstring "{ \"x_utils.h\", true, get_bits_le, set_bits_le, get_bits_be, set_bits_be },"
+            content |> should haveSubstring "static const uint8_t acc_payload_lengths[] = { 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };"
+            content |> should haveSubstring "tools/x_bit_accessors.c src/x_utils.c"
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``Bench rawRange follows the checked physical range`` () =
+        let scaled =
+            { mkSignal "Speed" 0us 16us with
+                Factor = 0.1
+                Offset = -40.0
+                Minimum = Some -40.0
+                Maximum = Some 200.0 }
+
+        Bench.rawRange scaled |> should equal (0L, 2400UL)
+
+        let signed =
+            { mkSignal "Temp" 0us 8us with
+                IsSigned = true
+                Minimum = Some -10.0
+                Maximum = Some 10.0 }
+
+        Bench.rawRange signed |> should equal (-10L, 20UL)
+
+        // min >= max means no range check, so any raw value decodes
+        let unchecked =
+            { mkSignal "Raw" 0us 12us with
+                Minimum = Some 0.0
+                Maximum = Some 0.0 }
+
+        Bench.rawRange unchecked |> should equal (0L, 4095UL)
+
+        Bench.rawRange (mkSignal "Wide" 0us 64us) |> should equal (0L, 255UL)
+
+        let wide =
+            { mkSignal "Wide" 0us 64us with
+                Minimum = None
+                Maximum = None }
+
+        Bench.rawRange wide |> should equal (0L, System.UInt64.MaxValue)
+
     // -------------------------------------------------------
     // CAN FD: Utils code generation tests
     // -------------------------------------------------------
@@ -391,7 +1033,9 @@ module CodegenTests =
                     Signals = [ mkSignal "FD_Sig" 0us 8us ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -621,7 +1265,9 @@ module CodegenTests =
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; mkSignal "CHECKSUM" 8us 8us ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = Some CrcCounterMode.Passthrough } ] }
+                    CrcCounterMode = Some CrcCounterMode.Passthrough
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         try
             match generate ir outDir passthroughCfg with
@@ -662,7 +1308,9 @@ module CodegenTests =
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; mkSignal "CHECKSUM" 8us 8us ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         try
             match generate ir outDir failFastCfg with
@@ -694,7 +1342,9 @@ module CodegenTests =
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; crcSignal ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = Some CrcCounterMode.Validate } ] }
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let cfg =
             { defaultConfig with
@@ -718,17 +1368,20 @@ module CodegenTests =
                 let msgC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "test_msg.c")
                 let content = File.ReadAllText(msgC)
                 content |> should haveSubstring "sc_crc8_sae_j1850"
-                content |> should haveSubstring "!= (uint8_t)msg->CHECKSUM) { return false; }"
+                content
+                |> should haveSubstring "if (sc_crc8_sae_j1850(&data[0], 1) != (uint8_t)get_bits_le(data, 8, 8)) { SC_PROF_FAIL(0, crc); return false; }"
                 content |> should haveSubstring "uint8_t crc_val_CHECKSUM = sc_crc8_sae_j1850"
             | Error e -> failwithf "Expected Ok, got: %A" e
         finally
             cleanupDir outDir
 
     [<Fact>]
-    let ``generate validate mode emits CRC-8 8H2F verification call`` () =
+    let ``generate validate mode starts CRC from precomputed Data ID seed`` () =
         let outDir = createTempOutDir ()
 
-        let crcMeta = mkCrcSignalMeta CrcAlgorithmId.CRC8_8H2F mkCrc88h2fParams 0 0
+        let crcMeta =
+            { mkCrcSignalMeta CrcAlgorithmId.CRC8_SAE_J1850 mkCrc8SaeJ1850Params 0 0 with
+                DataId = Some 0x1234us }
 
         let crcSignal =
             { (mkSignal "CHECKSUM" 8us 8us) with
@@ -738,13 +1391,15 @@ module CodegenTests =
         let ir =
             { Messages =
                 [ { Name = "TEST_MSG"
-                    Id = 203u
+                    Id = 202u
                     IsExtended = false
                     Length = 8us
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; crcSignal ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = Some CrcCounterMode.Validate } ] }
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let cfg =
             { defaultConfig with
@@ -756,9 +1411,9 @@ module CodegenTests =
                             "TEST_MSG"
                             (Some
                                 { Signal = "CHECKSUM"
-                                  Algorithm = "CRC8_8H2F"
+                                  Algorithm = "CRC8_SAE_J1850"
                                   ByteRange = (0, 0)
-                                  DataId = None })
+                                  DataId = Some 0x1234us })
                             None
                     ) }
 
@@ -767,7 +1422,460 @@ module CodegenTests =
             | Ok files ->
                 let msgC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "test_msg.c")
                 let content = File.ReadAllText(msgC)
-                content |> should haveSubstring "sc_crc8_8h2f"
+                // J1850 register after 0x34, 0x12 from init 0xFF
+                content |> should haveSubstring "if (sc_crc8_sae_j1850_seeded(0x5A, &data[0], 1) != (uint8_t)get_bits_le(data, 8, 8))"
+                content |> should haveSubstring "uint8_t crc_val_CHECKSUM = sc_crc8_sae_j1850_seeded(0x5A, &data[0], 1);"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate validate mode checks CRC and counter on raw payload before decoding signals`` () =
+        let outDir = createTempOutDir ()
+
+        let crcSignal =
+            { (mkSignal "CHECKSUM" 8us 8us) with
+                CrcMeta = Some(mkCrcSignalMeta CrcAlgorithmId.CRC8_SAE_J1850 mkCrc8SaeJ1850Params 1 7)
+                IsCrc = true }
+
+        let counterSignal =
+            { (mkSignal "COUNTER" 16us 4us) with
+                CounterMeta = Some { Modulus = 16; Increment = 1; MaxDelta = 1 }
+                IsCounter = true }
+
+        let ir =
+            { Messages =
+                [ { Name = "TEST_MSG"
+                    Id = 202u
+                    IsExtended = false
+                    Length = 8us
+                    Signals = [ mkSignal "PAYLOAD" 0us 8us; crcSignal; counterSignal ]
+                    Sender = "ECU"
+                    Receivers = []
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
+
+        let cfg =
+            { defaultConfig with
+                CrcCounterCheck = true
+                CrcCounter =
+                    Some(
+                        mkCrcCounterConfig
+                            "validate"
+                            "TEST_MSG"
+                            (Some
+                                { Signal = "CHECKSUM"
+                                  Algorithm = "CRC8_SAE_J1850"
+                                  ByteRange = (1, 7)
+                                  DataId = None })
+                            (Some
+                                { Signal = "COUNTER"
+                                  Modulus = 16
+                                  Increment = 1
+                                  MaxDelta = 1 })
+                    ) }
+
+        try
+            match generate ir outDir cfg with
+            | Ok files ->
+                let msgC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "test_msg.c")
+                let msgH = files.Headers |> List.find (fun f -> Path.GetFileName(f) = "test_msg.h")
+                let content = File.ReadAllText(msgC)
+                let crcCheck = content.IndexOf("if (sc_crc8_sae_j1850(&data[1], 7) != (uint8_t)get_bits_le(data, 8, 8))")
+                crcCheck |> should be (greaterThan -1)
+                // The plain decode rejects on CRC before handing off to signal extraction
+                crcCheck |> should be (lessThan (content.IndexOf("if (!TEST_MSG_decode_signals(msg, data)) { return false; }")))
+                content |> should haveSubstring "{ SC_PROF_FAIL(0, crc); return SC_E2E_ERR_CRC; }"
+
+                content
+                |> should haveSubstring "if (state != NULL && !TEST_MSG_counter_step(state, (uint8_t)get_bits_le(data, 16, 4))) { SC_PROF_FAIL(0, counter); return SC_E2E_ERR_COUNTER; }"
+
+                File.ReadAllText(msgH)
+                |> should
+                    haveSubstring
+                    "sc_e2e_status_t TEST_MSG_decode_e2e(TEST_MSG_t* msg, const uint8_t data[], uint8_t dlc, TEST_MSG_counter_state_t* state);"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate crc_patch emits per-signal patch helpers with CRC delta tables`` () =
+        let outDir = createTempOutDir ()
+
+        let crcSignal =
+            { (mkSignal "CHECKSUM" 0us 8us) with
+                CrcMeta = Some(mkCrcSignalMeta CrcAlgorithmId.CRC8_SAE_J1850 mkCrc8SaeJ1850Params 1 7)
+                IsCrc = true }
+
+        let ir =
+            { Messages =
+                [ { Name = "TEST_MSG"
+                    Id = 202u
+                    IsExtended = false
+                    Length = 8us
+                    Signals = [ crcSignal; mkSignal "SPEED" 12us 12us ]
+                    Sender = "ECU"
+                    Receivers = []
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
+
+        let cfg =
+            { defaultConfig with
+                CrcCounterCheck = true
+                CrcPatch = true
+                CrcCounter =
+                    Some(
+                        mkCrcCounterConfig
+                            "validate"
+                            "TEST_MSG"
+                            (Some
+                                { Signal = "CHECKSUM"
+                                  Algorithm = "CRC8_SAE_J1850"
+                                  ByteRange = (1, 7)
+                                  DataId = None })
+                            None
+                    ) }
+
+        try
+            match generate ir outDir cfg with
+            | Ok files ->
+                let msgC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "test_msg.c")
+                let msgH = files.Headers |> List.find (fun f -> Path.GetFileName(f) = "test_msg.h")
+                let content = File.ReadAllText(msgC)
+                // SPEED spans bytes 1..2, both inside the CRC range
+                content |> should haveSubstring "static const uint8_t TEST_MSG_SPEED_crc_delta[2][256] = {"
+                content |> should haveSubstring "    uint8_t old1 = data[1];"
+                content |> should haveSubstring "crc ^= TEST_MSG_SPEED_crc_delta[0][old1 ^ data[1]] ^"
+                content.Contains("TEST_MSG_patch_CHECKSUM") |> should equal false
+                File.ReadAllText(msgH) |> should haveSubstring "void TEST_MSG_patch_SPEED(uint8_t data[], uint64_t raw);"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate validate mode emits CRC-8 8H2F verification call`` () =
+        let outDir = createTempOutDir ()
+
+        let crcMeta = mkCrcSignalMeta CrcAlgorithmId.CRC8_8H2F mkCrc88h2fParams 0 0
+
+        let crcSignal =
+            { (mkSignal "CHECKSUM" 8us 8us) with
+                CrcMeta = Some crcMeta
+                IsCrc = true }
+
+        let ir =
+            { Messages =
+                [ { Name = "TEST_MSG"
+                    Id = 203u
+                    IsExtended = false
+                    Length = 8us
+                    Signals = [ mkSignal "PAYLOAD" 0us 8us; crcSignal ]
+                    Sender = "ECU"
+                    Receivers = []
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
+
+        let cfg =
+            { defaultConfig with
+                CrcCounterCheck = true
+                CrcCounter =
+                    Some(
+                        mkCrcCounterConfig
+                            "validate"
+                            "TEST_MSG"
+                            (Some
+                                { Signal = "CHECKSUM"
+                                  Algorithm = "CRC8_8H2F"
+                                  ByteRange = (0, 0)
+                                  DataId = None })
+                            None
+                    ) }
+
+        try
+            match generate ir outDir cfg with
+            | Ok files ->
+                let msgC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "test_msg.c")
+                let content = File.ReadAllText(msgC)
+                content |> should haveSubstring "sc_crc8_8h2f"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate validate mode emits CRC-32 P4 check on raw payload bits with slice-by-8 kernel`` () =
+        let outDir = createTempOutDir ()
+
+        let crcMeta = mkCrcSignalMeta CrcAlgorithmId.CRC32P4 mkCrc32P4Params 8 63
+
+        let crcSignal =
+            { (mkSignal "CRC" 32us 32us) with
+                CrcMeta = Some crcMeta
+                IsCrc = true }
+
+        let ir =
+            { Messages =
+                [ { Name = "TEST_MSG"
+                    Id = 204u
+                    IsExtended = false
+                    Length = 64us
+                    Signals = [ mkSignal "PAYLOAD" 0us 8us; crcSignal ]
+                    Sender = "ECU"
+                    Receivers = []
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
+
+        let cfg =
+            { defaultConfig with
+                CrcCounterCheck = true
+                CrcCounter =
+                    Some(
+                        mkCrcCounterConfig
+                            "validate"
+                            "TEST_MSG"
+                            (Some
+                                { Signal = "CRC"
+                                  Algorithm = "CRC32P4"
+                                  ByteRange = (8, 63)
+                                  DataId = None })
+                            None
+                    ) }
+
+        try
+            match generate ir outDir cfg with
+            | Ok files ->
+                let msgC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "test_msg.c")
+                let content = File.ReadAllText(msgC)
+                content |> should haveSubstring "sc_crc32_p4(&data[8], 56) != (uint32_t)get_bits_le(data, 32, 32)"
+                content |> should haveSubstring "uint32_t crc_val_CRC = sc_crc32_p4(&data[8], 56);"
+
+                let utilsC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_utils.c")
+                let utilsH = files.Headers |> List.find (fun f -> Path.GetFileName(f) = "sc_utils.h")
+                let utilsCContent = File.ReadAllText(utilsC)
+                utilsCContent |> should haveSubstring "sc_crc32_p4_table[8][256]"
+                utilsCContent |> should haveSubstring "0x00000000, 0x30850FF5, 0x610A1FEA"
+                utilsCContent |> should haveSubstring "__builtin_cpu_supports(\"pclmul\")"
+                utilsCContent.Contains("sc_crc16_ccitt") |> should equal false
+                File.ReadAllText(utilsH) |> should haveSubstring "uint32_t sc_crc32_p4(const uint8_t* data, size_t len);"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate rejects CRC signal narrower than its CRC-16 algorithm`` () =
+        let outDir = createTempOutDir ()
+
+        let crcMeta = mkCrcSignalMeta CrcAlgorithmId.CRC16_CCITT mkCrc16CcittParams 0 0
+
+        let crcSignal =
+            { (mkSignal "CHECKSUM" 8us 8us) with
+                CrcMeta = Some crcMeta
+                IsCrc = true }
+
+        let ir =
+            { Messages =
+                [ { Name = "TEST_MSG"
+                    Id = 205u
+                    IsExtended = false
+                    Length = 8us
+                    Signals = [ mkSignal "PAYLOAD" 0us 8us; crcSignal ]
+                    Sender = "ECU"
+                    Receivers = []
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
+
+        let cfg =
+            { defaultConfig with
+                CrcCounterCheck = true
+                CrcCounter =
+                    Some(
+                        mkCrcCounterConfig
+                            "validate"
+                            "TEST_MSG"
+                            (Some
+                                { Signal = "CHECKSUM"
+                                  Algorithm = "CRC16_CCITT"
+                                  ByteRange = (0, 0)
+                                  DataId = None })
+                            None
+                    ) }
+
+        try
+            match generate ir outDir cfg with
+            | Error(CodeGenError.UnsupportedFeature msg) ->
+                msg |> should haveSubstring "CHECKSUM"
+                msg |> should haveSubstring "16 bits"
+            | Error e -> failwithf "Expected UnsupportedFeature, got: %A" e
+            | Ok _ -> failwith "Expected UnsupportedFeature for 8-bit CRC-16 signal"
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate synthesizes table-driven implementation for custom reflected CRC-8`` () =
+        let outDir = createTempOutDir ()
+
+        let maximParams: CrcAlgorithmParams =
+            { Width = 8
+              Poly = 0x31UL
+              Init = 0x00UL
+              XorOut = 0x00UL
+              ReflectIn = true
+              ReflectOut = true }
+
+        let crcSignal =
+            { (mkSignal "CHECKSUM" 8us 8us) with
+                CrcMeta = Some(mkCrcSignalMeta (CrcAlgorithmId.Custom "CRC8-MAXIM") maximParams 0 0)
+                IsCrc = true }
+
+        let ir =
+            { Messages =
+                [ { Name = "TEST_MSG"
+                    Id = 206u
+                    IsExtended = false
+                    Length = 8us
+                    Signals = [ mkSignal "PAYLOAD" 0us 8us; crcSignal ]
+                    Sender = "ECU"
+                    Receivers = []
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
+
+        let cfg =
+            { defaultConfig with
+                CrcCounterCheck = true
+                CrcCounter =
+                    Some
+                        { mkCrcCounterConfig
+                              "validate"
+                              "TEST_MSG"
+                              (Some
+                                  { Signal = "CHECKSUM"
+                                    Algorithm = "CRC8-MAXIM"
+                                    ByteRange = (0, 0)
+                                    DataId = None })
+                              None with
+                            CustomAlgorithms =
+                                Some(
+                                    Map.ofList
+                                        [ "CRC8-MAXIM",
+                                          {| Width = 8
+                                             Poly = 0x31UL
+                                             Init = 0x00UL
+                                             XorOut = 0x00UL
+                                             ReflectIn = true
+                                             ReflectOut = true |} ]
+                                ) } }
+
+        try
+            match generate ir outDir cfg with
+            | Ok files ->
+                let msgC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "test_msg.c")
+                File.ReadAllText(msgC) |> should haveSubstring "sc_crc8_crc8_maxim(&data[0], 1)"
+
+                let utilsC = files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_utils.c")
+                let utilsH = files.Headers |> List.find (fun f -> Path.GetFileName(f) = "sc_utils.h")
+                let utilsCContent = File.ReadAllText(utilsC)
+                utilsCContent |> should haveSubstring "static const uint8_t sc_crc8_crc8_maxim_table[256] = {"
+                utilsCContent |> should haveSubstring "    0x00, 0x5E, 0xBC, 0xE2,"
+                utilsCContent |> should haveSubstring "crc = sc_crc8_crc8_maxim_table[crc ^ data[i]];"
+
+                File.ReadAllText(utilsH)
+                |> should haveSubstring "uint8_t sc_crc8_crc8_maxim(const uint8_t* data, size_t len);"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with e2e_supervisor tables validate-mode counters and checks CRC on raw bytes`` () =
+        let outDir = createTempOutDir ()
+
+        let counterSignal =
+            { (mkSignal "COUNTER" 8us 4us) with
+                CounterMeta = Some { Modulus = 16; Increment = 2; MaxDelta = 3 }
+                IsCounter = true }
+
+        let crcSignal =
+            { (mkSignal "CRC" 0us 8us) with
+                CrcMeta = Some(mkCrcSignalMeta CrcAlgorithmId.CRC8_SAE_J1850 mkCrc8SaeJ1850Params 1 7) }
+
+        let protectedMsg =
+            { Name = "PROT_MSG"
+              Id = 400u
+              IsExtended = false
+              Length = 8us
+              Signals = [ crcSignal; counterSignal; mkSignal "VALUE" 16us 8us ]
+              Sender = "ECU"
+              Receivers = []
+              CrcCounterMode = Some CrcCounterMode.Validate
+              CycleTimeMs = None
+              StartDelayMs = None }
+
+        let ir =
+            { Messages =
+                [ protectedMsg
+                  { protectedMsg with
+                      Name = "PASS_MSG"
+                      Id = 401u
+                      CrcCounterMode = Some CrcCounterMode.Passthrough }
+                  singleMessageIr.Messages.Head ] }
+
+        try
+            match generate ir outDir { defaultConfig with E2eSupervisor = true } with
+            | Ok files ->
+                let supH =
+                    files.Headers |> List.find (fun f -> Path.GetFileName(f) = "sc_e2e_supervisor.h")
+
+                let supC =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_e2e_supervisor.c")
+
+                let header = File.ReadAllText(supH)
+                let content = File.ReadAllText(supC)
+                header |> should haveSubstring "#define E2E_SUP_MESSAGE_COUNT 1"
+                header |> should haveSubstring "#define E2E_SUP_INDEX_PROT_MSG 0"
+                content |> should haveSubstring "{ 400u, 16u, 2u, 3u, e2e_read_PROT_MSG },"
+
+                content
+                |> should haveSubstring "if (sc_crc8_sae_j1850(&data[1], 7) != (uint8_t)get_bits_le(data, 0, 8)) { return E2E_SUP_WRONG_CRC; }"
+
+                content
+                |> should haveSubstring "*counter = (e2e_sup_counter_t)get_bits_le(data, 8, 4);"
+
+                content |> should not' (haveSubstring "PASS_MSG")
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            cleanupDir outDir
+
+    [<Fact>]
+    let ``generate with e2e_supervisor keeps a full 16-bit counter modulus`` () =
+        let outDir = createTempOutDir ()
+
+        let counterSignal =
+            { (mkSignal "COUNTER" 16us 16us) with
+                CounterMeta = Some { Modulus = 65536; Increment = 1; MaxDelta = 1 }
+                IsCounter = true }
+
+        let ir =
+            { Messages =
+                [ { singleMessageIr.Messages.Head with
+                      Name = "WIDE_MSG"
+                      Id = 402u
+                      Signals = [ counterSignal ]
+                      CrcCounterMode = Some CrcCounterMode.Validate } ] }
+
+        try
+            match generate ir outDir { defaultConfig with E2eSupervisor = true } with
+            | Ok files ->
+                let supC =
+                    files.Sources |> List.find (fun f -> Path.GetFileName(f) = "sc_e2e_supervisor.c")
+
+                let content = File.ReadAllText(supC)
+                content |> should haveSubstring "typedef uint16_t e2e_sup_counter_t;"
+                content |> should haveSubstring "    uint32_t modulus;"
+                content |> should haveSubstring "{ 402u, 65536u, 1u, 1u, e2e_read_WIDE_MSG },"
             | Error e -> failwithf "Expected Ok, got: %A" e
         finally
             cleanupDir outDir
@@ -778,7 +1886,7 @@ module CodegenTests =
 
         let counterSignal =
             { (mkSignal "COUNTER" 16us 4us) with
-                CounterMeta = Some { Modulus = 15; Increment = 1 }
+                CounterMeta = Some { Modulus = 15; Increment = 1; MaxDelta = 1 }
                 IsCounter = true }
 
         let ir =
@@ -790,7 +1898,9 @@ module CodegenTests =
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; counterSignal ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = Some CrcCounterMode.Validate } ] }
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let cfg =
             { defaultConfig with
@@ -804,7 +1914,8 @@ module CodegenTests =
                             (Some
                                 { Signal = "COUNTER"
                                   Modulus = 15
-                                  Increment = 1 })
+                                  Increment = 1
+                                  MaxDelta = 1 })
                     ) }
 
         try
@@ -824,7 +1935,7 @@ module CodegenTests =
 
         let counterSignal =
             { (mkSignal "COUNTER" 16us 4us) with
-                CounterMeta = Some { Modulus = 15; Increment = 1 }
+                CounterMeta = Some { Modulus = 15; Increment = 1; MaxDelta = 1 }
                 IsCounter = true }
 
         let ir =
@@ -836,7 +1947,9 @@ module CodegenTests =
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; counterSignal ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = Some CrcCounterMode.Validate } ] }
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let cfg =
             { defaultConfig with
@@ -850,7 +1963,8 @@ module CodegenTests =
                             (Some
                                 { Signal = "COUNTER"
                                   Modulus = 15
-                                  Increment = 1 })
+                                  Increment = 1
+                                  MaxDelta = 1 })
                     ) }
 
         try
@@ -877,7 +1991,9 @@ module CodegenTests =
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; mkSignal "STATUS" 8us 8us ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         try
             match generate ir outDir defaultConfig with
@@ -916,7 +2032,9 @@ module CodegenTests =
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; crcSignal ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = Some CrcCounterMode.Validate } ] }
+                    CrcCounterMode = Some CrcCounterMode.Validate
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let cfg =
             { defaultConfig with
@@ -964,7 +2082,9 @@ module CodegenTests =
                     Signals = [ mkSignal "PAYLOAD" 0us 8us; mkSignal "STATUS" 8us 8us ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         try
             match generate ir outDir defaultConfig with
@@ -996,7 +2116,9 @@ module CodegenTests =
                             Minimum = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -1026,7 +2148,9 @@ module CodegenTests =
                             Minimum = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -1056,7 +2180,9 @@ module CodegenTests =
                             Minimum = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let lsbConfig =
             { defaultConfig with
@@ -1093,7 +2219,9 @@ module CodegenTests =
                             Minimum = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -1140,7 +2268,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1188,7 +2318,9 @@ module CodegenTests =
               Signals = [ invSig ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1229,7 +2361,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1260,7 +2394,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1291,7 +2427,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1321,7 +2459,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1351,7 +2491,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1381,7 +2523,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1411,7 +2555,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1442,7 +2588,9 @@ module CodegenTests =
               Signals = [ signal ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1473,7 +2621,9 @@ module CodegenTests =
               Signals = [ sigA; sigB ]
               Sender = "ECU"
               Receivers = []
-              CrcCounterMode = None }
+              CrcCounterMode = None
+              CycleTimeMs = None
+              StartDelayMs = None }
 
         let ir = { Messages = [ msg ] }
         let config = { defaultConfig with RangeCheck = true }
@@ -1541,7 +2691,9 @@ module CodegenTests =
                 Signals = [ switchSig ] @ branchSignals @ baseSignals
                 Sender = "ECU"
                 Receivers = []
-                CrcCounterMode = None } ] }
+                CrcCounterMode = None
+                CycleTimeMs = None
+                StartDelayMs = None } ] }
 
     [<Fact>]
     let ``valid bitmask uses uint32_t for 8-signal mux message`` () =
@@ -1799,7 +2951,9 @@ module CodegenTests =
                     Signals = signals
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -23,7 +23,21 @@ module ConfigTests =
           CrcCounterCheck = false
           MotorolaStartBit = "msb"
           FilePrefix = "sc_"
-          CrcCounter = None }
+          CrcCounter = None
+          RegistryCache = false
+          Subscriptions = false
+          TxScheduler = false
+          RxMonitor = false
+          RxTimeoutFactor = 3
+          CrcPatch = false
+          E2eSupervisor = false
+          CppHeader = false
+          CodegenStyle = "unrolled"
+          DescriptorBlob = false
+          LogDecoder = false
+          ArrowWriter = false
+          SocketCan = false
+          EbpfSignals = [] }
 
     // -------------------------------------------------------
     // Config.validate tests
@@ -161,6 +175,172 @@ file_prefix: fw_
         finally
             File.Delete(path)
 
+    [<Fact>]
+    let ``loadFromYaml parses registry_cache and defaults to false`` () =
+        let enabled = createTempFile "registry_cache: true\n" ".yaml"
+        let omitted = createTempFile "dispatch: binary_search\n" ".yaml"
+
+        try
+            match loadFromYaml enabled, loadFromYaml omitted with
+            | Ok on, Ok off ->
+                on.RegistryCache |> should equal true
+                off.RegistryCache |> should equal false
+            | r -> failwithf "Expected Ok, got: %A" r
+        finally
+            File.Delete(enabled)
+            File.Delete(omitted)
+
+    [<Fact>]
+    let ``loadFromYaml parses subscriptions and tx_scheduler flags`` () =
+        let path = createTempFile "subscriptions: true\ntx_scheduler: true\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg ->
+                cfg.Subscriptions |> should equal true
+                cfg.TxScheduler |> should equal true
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``loadFromYaml parses rx_monitor with timeout factor`` () =
+        let path = createTempFile "rx_monitor: true\nrx_timeout_factor: 2\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg ->
+                cfg.RxMonitor |> should equal true
+                cfg.RxTimeoutFactor |> should equal 2
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``validate rejects rx_timeout_factor below 1`` () =
+        let cfg = { validConfig with RxTimeoutFactor = 0 }
+
+        match validate cfg with
+        | Error(ValidationError.InvalidValue msg) -> msg |> should haveSubstring "rx_timeout_factor"
+        | Error e -> failwithf "Expected InvalidValue, got: %A" e
+        | Ok _ -> failwith "Expected error for rx_timeout_factor = 0"
+
+    [<Fact>]
+    let ``loadFromYaml parses crc_patch flag`` () =
+        let path = createTempFile "crc_patch: true\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.CrcPatch |> should equal true
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``loadFromYaml parses e2e_supervisor flag`` () =
+        let path = createTempFile "e2e_supervisor: true\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.E2eSupervisor |> should equal true
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``loadFromYaml parses cpp_header flag`` () =
+        let path = createTempFile "cpp_header: true\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.CppHeader |> should equal true
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``loadFromYaml parses codegen_style`` () =
+        let path = createTempFile "codegen_style: table\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.CodegenStyle |> should equal "table"
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``validate rejects invalid CodegenStyle`` () =
+        let cfg =
+            { validConfig with
+                CodegenStyle = "interpreted" }
+
+        match validate cfg with
+        | Error(ValidationError.InvalidValue msg) -> msg |> should haveSubstring "codegen_style"
+        | Error e -> failwithf "Expected InvalidValue, got: %A" e
+        | Ok _ -> failwith "Expected error for invalid CodegenStyle"
+
+    [<Fact>]
+    let ``loadFromYaml parses descriptor_blob flag`` () =
+        let path = createTempFile "descriptor_blob: true\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.DescriptorBlob |> should equal true
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``loadFromYaml parses arrow_writer flag`` () =
+        let path = createTempFile "arrow_writer: true\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.ArrowWriter |> should equal true
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``loadFromYaml parses socketcan flag`` () =
+        let path = createTempFile "socketcan: true\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.SocketCan |> should equal true
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``loadFromYaml parses ebpf_signals list and rejects malformed entries`` () =
+        let path = createTempFile "ebpf_signals:\n  - WHEELS.WS_FL\n  - WHEELS.WS_FR\n" ".yaml"
+        let badPath = createTempFile "ebpf_signals: [ WS_FL ]\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.EbpfSignals |> should equal [ "WHEELS.WS_FL"; "WHEELS.WS_FR" ]
+            | Error e -> failwithf "Expected Ok, got: %A" e
+
+            match loadFromYaml badPath with
+            | Error(ValidationError.InvalidValue msg) -> msg |> should haveSubstring "WS_FL"
+            | other -> failwithf "Expected InvalidValue, got: %A" other
+        finally
+            File.Delete(path)
+            File.Delete(badPath)
+
+    [<Fact>]
+    let ``loadFromYaml parses log_decoder flag`` () =
+        let path = createTempFile "log_decoder: true\n" ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.LogDecoder |> should equal true
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
     // -------------------------------------------------------
     // CRC / Counter parsing & validation tests (T13)
     // -------------------------------------------------------
@@ -317,7 +497,7 @@ crc_counter:
             File.Delete(path)
 
     [<Fact>]
-    let ``validation rejects non-8-bit CRC algorithm (e.g. CRC16_CCITT)`` () =
+    let ``validation accepts CRC16_CCITT and CRC32P4 builtin algorithms`` () =
         let yaml =
             """
 crc_counter_check: true
@@ -329,6 +509,39 @@ crc_counter:
         signal: CRCsig
         algorithm: CRC16_CCITT
         byte_range: [0, 2]
+    MsgB:
+      crc:
+        signal: CRCsig
+        algorithm: CRC32P4
+        byte_range: [4, 63]
+"""
+
+        let path = createTempFile yaml ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg -> cfg.CrcCounter.Value.Messages.Count |> should equal 2
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``validation rejects non-8-bit custom CRC algorithm`` () =
+        let yaml =
+            """
+crc_counter_check: true
+crc_counter:
+  mode: validate
+  algorithms:
+    MY_CRC16:
+      width: 16
+      poly: 0x8005
+  messages:
+    MsgA:
+      crc:
+        signal: CRCsig
+        algorithm: MY_CRC16
+        byte_range: [0, 2]
 """
 
         let path = createTempFile yaml ".yaml"
@@ -337,7 +550,7 @@ crc_counter:
             match loadFromYaml path with
             | Error(ConfigConflict msg) -> msg |> should haveSubstring "must be 8"
             | Error e -> failwithf "Expected ConfigConflict, got: %A" e
-            | Ok _ -> failwith "Expected validation error for non-8-bit CRC algorithm"
+            | Ok _ -> failwith "Expected validation error for non-8-bit custom CRC algorithm"
         finally
             File.Delete(path)
 
@@ -368,6 +581,63 @@ crc_counter:
         finally
             File.Delete(path)
 
+    [<Fact>]
+    let ``counter max_delta defaults to 1 and parses when set`` () =
+        let yaml =
+            """
+crc_counter_check: true
+crc_counter:
+  mode: validate
+  messages:
+    MsgA:
+      counter:
+        signal: Cnt
+        modulus: 16
+    MsgB:
+      counter:
+        signal: Cnt
+        modulus: 16
+        max_delta: 3
+"""
+
+        let path = createTempFile yaml ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Ok cfg ->
+                let messages = cfg.CrcCounter.Value.Messages
+                messages.["MsgA"].Counter.Value.MaxDelta |> should equal 1
+                messages.["MsgB"].Counter.Value.MaxDelta |> should equal 3
+            | Error e -> failwithf "Expected Ok, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``validation rejects max_delta that wraps the counter`` () =
+        let yaml =
+            """
+crc_counter_check: true
+crc_counter:
+  mode: validate
+  messages:
+    MsgB:
+      counter:
+        signal: Cnt
+        modulus: 16
+        increment: 2
+        max_delta: 8
+"""
+
+        let path = createTempFile yaml ".yaml"
+
+        try
+            match loadFromYaml path with
+            | Error(InvalidValue msg) -> msg |> should haveSubstring "max_delta"
+            | Error e -> failwithf "Expected InvalidValue, got: %A" e
+            | Ok _ -> failwith "Expected validation error for max_delta"
+        finally
+            File.Delete(path)
+
     [<Fact>]
     let ``validation rejects empty CRC signal name`` () =
         let yaml =
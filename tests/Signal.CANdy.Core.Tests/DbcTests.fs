@@ -294,6 +294,79 @@ VAL_ 200 State 0 "IDLE" 1 "RUN" 2 "STOP" ;
         finally
             File.Delete(path)
 
+    [<Fact>]
+    let ``parseDbcFile reads GenMsgCycleTime and GenMsgStartDelayTime`` () =
+        let dbc =
+            """
+VERSION ""
+NS_ :
+BS_:
+
+BO_ 100 FAST: 8 Vector__XXX
+ SG_ Speed : 0|16@1+ (1,0) [0|65535] "" Vector__XXX
+
+BO_ 200 SLOW: 8 Vector__XXX
+ SG_ Temp : 0|8@1+ (1,0) [0|255] "" Vector__XXX
+
+BO_ 300 EVENT: 8 Vector__XXX
+ SG_ Flag : 0|1@1+ (1,0) [0|1] "" Vector__XXX
+
+BA_DEF_ BO_  "GenMsgCycleTime" INT 0 65535;
+BA_DEF_ BO_  "GenMsgStartDelayTime" INT 0 65535;
+BA_DEF_DEF_  "GenMsgCycleTime" 0;
+BA_DEF_DEF_  "GenMsgStartDelayTime" 0;
+BA_ "GenMsgCycleTime" BO_ 100 10;
+BA_ "GenMsgCycleTime" BO_ 200 1000;
+BA_ "GenMsgStartDelayTime" BO_ 200 20;
+"""
+
+        let path = createTempDbcFile dbc
+
+        try
+            match parseDbcFile path with
+            | Ok ir ->
+                let find name =
+                    ir.Messages |> List.find (fun m -> m.Name = name)
+
+                (find "FAST").CycleTimeMs |> should equal (Some 10)
+                (find "FAST").StartDelayMs |> should equal None
+                (find "SLOW").CycleTimeMs |> should equal (Some 1000)
+                (find "SLOW").StartDelayMs |> should equal (Some 20)
+                (find "EVENT").CycleTimeMs |> should equal None
+            | Error e -> failwithf "Expected success, got: %A" e
+        finally
+            File.Delete(path)
+
+    [<Fact>]
+    let ``parseDbcFile reads signal receivers`` () =
+        let dbc =
+            """
+VERSION ""
+NS_ :
+BS_:
+
+BU_: GW ECU1 ECU2
+
+BO_ 100 STATUS: 8 GW
+ SG_ Speed : 0|16@1+ (1,0) [0|65535] "km/h" ECU1,ECU2
+ SG_ Mode : 16|8@1+ (1,0) [0|255] "" ECU1
+ SG_ Spare : 24|8@1+ (1,0) [0|255] "" Vector__XXX
+"""
+
+        let path = createTempDbcFile dbc
+
+        try
+            match parseDbcFile path with
+            | Ok ir ->
+                let msg = ir.Messages |> List.exactlyOne
+                let find name = msg.Signals |> List.find (fun s -> s.Name = name)
+                (find "Speed").Receivers |> should equal [ "ECU1"; "ECU2" ]
+                (find "Spare").Receivers |> should equal List.empty<string>
+                msg.Receivers |> should equal [ "ECU1"; "ECU2" ]
+            | Error e -> failwithf "Expected success, got: %A" e
+        finally
+            File.Delete(path)
+
     [<Fact>]
     let ``parseDbcFile succeeds for empty DBC (no messages)`` () =
         let dbc =
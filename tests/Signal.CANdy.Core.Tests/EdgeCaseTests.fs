@@ -20,7 +20,21 @@ module EdgeCaseTests =
           CrcCounterCheck = false
           MotorolaStartBit = "msb"
           FilePrefix = "sc_"
-          CrcCounter = None }
+          CrcCounter = None
+          RegistryCache = false
+          Subscriptions = false
+          TxScheduler = false
+          RxMonitor = false
+          RxTimeoutFactor = 3
+          CrcPatch = false
+          E2eSupervisor = false
+          CppHeader = false
+          CodegenStyle = "unrolled"
+          DescriptorBlob = false
+          LogDecoder = false
+          ArrowWriter = false
+          SocketCan = false
+          EbpfSignals = [] }
 
     /// Helper: create temp output directory
     let private createTempOutDir () =
@@ -123,7 +137,9 @@ BO_ 500 MOTO_MSG: 8 Vector__XXX
                           CounterMeta = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -191,7 +207,9 @@ BO_ 500 MOTO_MSG: 8 Vector__XXX
                           CounterMeta = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -241,7 +259,9 @@ BO_ 500 MOTO_MSG: 8 Vector__XXX
                           CounterMeta = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -286,7 +306,9 @@ BO_ 500 MOTO_MSG: 8 Vector__XXX
                           CounterMeta = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
@@ -330,7 +352,9 @@ BO_ 500 MOTO_MSG: 8 Vector__XXX
                           CounterMeta = None } ]
                     Sender = "ECU"
                     Receivers = []
-                    CrcCounterMode = None } ] }
+                    CrcCounterMode = None
+                    CycleTimeMs = None
+                    StartDelayMs = None } ] }
 
         let outDir = createTempOutDir ()
 
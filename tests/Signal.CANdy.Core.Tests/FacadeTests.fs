@@ -71,7 +71,9 @@ module FacadeTests =
                 Signals = [ switchSig ] @ branchSignals
                 Sender = "ECU"
                 Receivers = []
-                CrcCounterMode = None } ] }
+                CrcCounterMode = None
+                CycleTimeMs = None
+                StartDelayMs = None } ] }
 
     let private defaultConfig: Config =
         { PhysType = "float"
@@ -81,7 +83,21 @@ module FacadeTests =
           CrcCounterCheck = false
           MotorolaStartBit = "msb"
           FilePrefix = "sc_"
-          CrcCounter = None }
+          CrcCounter = None
+          RegistryCache = false
+          Subscriptions = false
+          TxScheduler = false
+          RxMonitor = false
+          RxTimeoutFactor = 3
+          CrcPatch = false
+          E2eSupervisor = false
+          CppHeader = false
+          CodegenStyle = "unrolled"
+          DescriptorBlob = false
+          LogDecoder = false
+          ArrowWriter = false
+          SocketCan = false
+          EbpfSignals = [] }
 
     // -------------------------------------------------------
     // H-3c: Facade unit tests — exception type verification
@@ -164,7 +180,21 @@ phys_type: INVALID_TYPE
               CrcCounterCheck = false
               MotorolaStartBit = "msb"
               FilePrefix = "sc_"
-              CrcCounter = None }
+              CrcCounter = None
+              RegistryCache = false
+              Subscriptions = false
+              TxScheduler = false
+              RxMonitor = false
+              RxTimeoutFactor = 3
+              CrcPatch = false
+              E2eSupervisor = false
+              CppHeader = false
+              CodegenStyle = "unrolled"
+              DescriptorBlob = false
+              LogDecoder = false
+              ArrowWriter = false
+              SocketCan = false
+              EbpfSignals = [] }
 
         let ex =
             Assert.Throws<SignalCandyValidationException>(fun () -> facade.ValidateConfig(badConfig))
@@ -289,7 +319,7 @@ crc_counter:
                 Directory.Delete(outDir, true)
 
     [<Fact>]
-    let ``GenerateFromPathsAsync throws SignalCandyValidationException for non-8-bit CRC algorithm`` () =
+    let ``GenerateFromPathsAsync throws SignalCandyValidationException when CRC signal is narrower than its algorithm`` () =
         let facade = GeneratorFacade()
 
         let dbcContent =
@@ -334,7 +364,7 @@ crc_counter:
                     facade.GenerateFromPathsAsync(dbcPath, outDir, configPath) :> System.Threading.Tasks.Task)
 
             let result = ex.GetAwaiter().GetResult()
-            result.Message |> should haveSubstring "ConfigConflict"
+            result.Message |> should haveSubstring "CrcWidthMismatch"
         finally
             File.Delete(dbcPath)
             File.Delete(configPath)
@@ -7,7 +7,8 @@
 #include <math.h>
 
 bool MESSAGE_1_decode(MESSAGE_1_t* msg, const uint8_t data[], uint8_t dlc) {
-    if (dlc < 8) { return false; }
+    SC_PROF_BEGIN(0, decode);
+    if (dlc < 8) { SC_PROF_FAIL(0, length); return false; }
     uint64_t raw_Signal_1 = 0;
     // Signal_1: start=0 len=8 factor=1 offset=0
     raw_Signal_1 = get_bits_le(data, 0, 8);
@@ -19,10 +20,12 @@ bool MESSAGE_1_decode(MESSAGE_1_t* msg, const uint8_t data[], uint8_t dlc) {
     raw_Signal_2 = get_bits_le(data, 8, 16);
     msg->Signal_2 = (float)((double)raw_Signal_2 * 0.10000000000000001 + 0);
     if (msg->Signal_2 < 0 || msg->Signal_2 > 100) { return false; }
+    SC_PROF_END(0, decode);
     return true;
 }
 
 bool MESSAGE_1_encode(uint8_t data[], uint8_t* out_dlc, const MESSAGE_1_t* msg) {
+    SC_PROF_BEGIN(0, encode);
     memset(data, 0, 8);
     *out_dlc = 8;
     if (msg->Signal_1 < 0 || msg->Signal_1 > 255) { return false; }
@@ -34,5 +37,6 @@ bool MESSAGE_1_encode(uint8_t data[], uint8_t* out_dlc, const MESSAGE_1_t* msg)
     double tmp_Signal_2 = ((double)msg->Signal_2 - 0) / 0.10000000000000001;
     int64_t raw_Signal_2 = (int64_t)(tmp_Signal_2 >= 0 ? tmp_Signal_2 + 0.5 : tmp_Signal_2 - 0.5);
     set_bits_le(data, 8, 16, (uint64_t)raw_Signal_2);
+    SC_PROF_END(0, encode);
     return true;
 }
@@ -7,7 +7,8 @@
 #include <math.h>
 
 bool MUX_MSG_decode(MUX_MSG_t* msg, const uint8_t data[], uint8_t dlc) {
-    if (dlc < 8) { return false; }
+    SC_PROF_BEGIN(0, decode);
+    if (dlc < 8) { SC_PROF_FAIL(0, length); return false; }
     msg->valid = 0u;
 
     uint64_t raw_MuxSwitch = 0;
@@ -41,10 +42,12 @@ bool MUX_MSG_decode(MUX_MSG_t* msg, const uint8_t data[], uint8_t dlc) {
     if (msg->Sig_m2 < 0 || msg->Sig_m2 > 65535) { return false; }
     msg->valid |= MUX_MSG_VALID_SIG_M2;
     }
+    SC_PROF_END(0, decode);
     return true;
 }
 
 bool MUX_MSG_encode(uint8_t data[], uint8_t* out_dlc, const MUX_MSG_t* msg) {
+    SC_PROF_BEGIN(0, encode);
     memset(data, 0, 8);
     *out_dlc = 8;
     if (msg->MuxSwitch < 0 || msg->MuxSwitch > 3) { return false; }
@@ -71,5 +74,6 @@ bool MUX_MSG_encode(uint8_t data[], uint8_t* out_dlc, const MUX_MSG_t* msg) {
     int64_t raw_Sig_m2 = (int64_t)(tmp_Sig_m2 >= 0 ? tmp_Sig_m2 + 0.5 : tmp_Sig_m2 - 0.5);
     set_bits_le(data, 16, 16, (uint64_t)raw_Sig_m2);
     }
+    SC_PROF_END(0, encode);
     return true;
 }
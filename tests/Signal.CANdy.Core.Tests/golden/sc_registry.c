@@ -3,6 +3,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "sc_registry.h"
+#include "sc_utils.h"
 #include "message_1.h"
 
 typedef bool (*decode_func_t)(void* msg, const uint8_t data[], uint8_t dlc);
@@ -22,5 +23,70 @@ bool decode_message(uint32_t id, const uint8_t data[], uint8_t dlc, void* msg) {
         }
         if (decoders[mid].id < id) low = mid + 1; else high = mid - 1;
     }
+    SC_PROF_UNKNOWN_ID();
     return false;
 }
+
+#ifdef SC_PROF
+#include <stdarg.h>
+#include <stdio.h>
+
+sc_prof_stats_t sc_prof_stats[SC_PROF_MESSAGE_COUNT] = {
+    { .id = 100u, .name = "MESSAGE_1" }
+};
+
+uint64_t sc_prof_unknown_ids;
+
+const sc_prof_stats_t* sc_prof_get(size_t* count) {
+    *count = sizeof(sc_prof_stats) / sizeof(sc_prof_stats[0]);
+    return sc_prof_stats;
+}
+
+void sc_prof_reset(void) {
+    for (size_t i = 0; i < sizeof(sc_prof_stats) / sizeof(sc_prof_stats[0]); ++i) {
+        sc_prof_stats_t cleared = { .id = sc_prof_stats[i].id, .name = sc_prof_stats[i].name };
+        sc_prof_stats[i] = cleared;
+    }
+    sc_prof_unknown_ids = 0;
+}
+
+static void sc_prof_append(char* buf, size_t size, size_t* pos, const char* fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(*pos < size ? buf + *pos : NULL, *pos < size ? size - *pos : 0, fmt, ap);
+    va_end(ap);
+    if (n > 0) *pos += (size_t)n;
+}
+
+static void sc_prof_append_op(char* buf, size_t size, size_t* pos, const char* key, const sc_prof_op_t* op) {
+    sc_prof_append(buf, size, pos, "\"%s\":{\"calls\":%llu,\"ok\":%llu,\"ticks\":%llu,\"max\":%llu,\"hist\":[",
+                   key, (unsigned long long)op->calls, (unsigned long long)op->ok,
+                   (unsigned long long)op->ticks, (unsigned long long)op->max_ticks);
+    for (size_t b = 0; b < SC_PROF_BUCKETS; ++b) {
+        sc_prof_append(buf, size, pos, b == 0 ? "%lu" : ",%lu", (unsigned long)op->hist[b]);
+    }
+    sc_prof_append(buf, size, pos, "]}");
+}
+
+size_t sc_prof_format_json(char* buf, size_t size) {
+    size_t pos = 0;
+    bool first = true;
+    sc_prof_append(buf, size, &pos, "{\"unit\":\"%s\",\"unknown_ids\":%llu,\"messages\":[",
+                   SC_PROF_UNIT, (unsigned long long)sc_prof_unknown_ids);
+    for (size_t i = 0; i < sizeof(sc_prof_stats) / sizeof(sc_prof_stats[0]); ++i) {
+        const sc_prof_stats_t* s = &sc_prof_stats[i];
+        if (s->decode.calls == 0 && s->encode.calls == 0) continue;
+        sc_prof_append(buf, size, &pos, "%s{\"id\":%lu,\"name\":\"%s\",", first ? "" : ",",
+                       (unsigned long)s->id, s->name);
+        sc_prof_append_op(buf, size, &pos, "decode", &s->decode);
+        sc_prof_append(buf, size, &pos, ",");
+        sc_prof_append_op(buf, size, &pos, "encode", &s->encode);
+        sc_prof_append(buf, size, &pos, ",\"fail\":{\"length\":%llu,\"range\":%llu,\"crc\":%llu,\"counter\":%llu}}",
+                       (unsigned long long)s->fail_length, (unsigned long long)sc_prof_fail_range(s),
+                       (unsigned long long)s->fail_crc, (unsigned long long)s->fail_counter);
+        first = false;
+    }
+    sc_prof_append(buf, size, &pos, "]}");
+    return pos;
+}
+#endif
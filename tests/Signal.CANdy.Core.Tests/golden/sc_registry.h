@@ -5,6 +5,10 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#ifdef SC_PROF
+#include <stddef.h>
+#include "sc_utils.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -12,6 +16,16 @@ extern "C" {
 
 bool decode_message(uint32_t id, const uint8_t data[], uint8_t dlc, void* msg);
 
+#ifdef SC_PROF
+/* Decode/encode profile (see sc_utils.h). sc_prof_get returns the stats array, one
+   entry per message in DBC order, e.g. to copy or dump it raw. sc_prof_format_json writes the
+   messages seen so far as JSON into buf and, like snprintf, returns the full length; call it with
+   size 0 to size the buffer. */
+const sc_prof_stats_t* sc_prof_get(size_t* count);
+void sc_prof_reset(void);
+size_t sc_prof_format_json(char* buf, size_t size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,8 @@
 /* Generated by Signal CANdy
    file_prefix=sc_, phys_type=float, phys_mode=double, dispatch=binary_search, motorola_start_bit=msb */
+#if defined(SC_PROF) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
 #include "sc_utils.h"
 
 /* CAN FD DLC to payload length mapping (ISO 11898-1) */
@@ -21,16 +24,30 @@ uint8_t canfd_len_to_dlc(uint8_t len) {
     return 15;
 }
 
+#ifdef SC_PROF_CLOCK_GETTIME
+#include <time.h>
+
+uint64_t sc_prof_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+
 // Little-endian bit extraction (supports CAN FD up to 64 bytes)
+// A field up to 64 bits wide spans at most 9 bytes; the 9th only when bit_offset > 0.
 uint64_t get_bits_le(const uint8_t* data, uint16_t start_bit, uint16_t length) {
     uint64_t value = 0;
     uint16_t byte_offset = start_bit / 8;
     uint16_t bit_offset = start_bit % 8;
     uint16_t n_bytes = (bit_offset + length + 7) / 8;
-    for (uint16_t i = 0; i < n_bytes; ++i) {
+    for (uint16_t i = 0; i < n_bytes && i < 8; ++i) {
         value |= (uint64_t)data[byte_offset + i] << (i * 8);
     }
     value >>= bit_offset;
+    if (n_bytes > 8) {
+        value |= (uint64_t)data[byte_offset + 8] << (64 - bit_offset);
+    }
     value &= (length == 64) ? UINT64_MAX : ((1ULL << length) - 1);
     return value;
 }
@@ -42,13 +59,18 @@ void set_bits_le(uint8_t* data, uint16_t start_bit, uint16_t length, uint64_t va
     uint64_t mask = (length == 64) ? UINT64_MAX : ((1ULL << length) - 1);
     uint64_t clear_mask = mask << bit_offset;
     uint16_t n_bytes = (bit_offset + length + 7) / 8;
-    for (uint16_t i = 0; i < n_bytes; ++i) {
+    for (uint16_t i = 0; i < n_bytes && i < 8; ++i) {
         data[byte_offset + i] &= ~(uint8_t)(clear_mask >> (i * 8));
     }
     uint64_t insert_value = (value & mask) << bit_offset;
-    for (uint16_t i = 0; i < n_bytes; ++i) {
+    for (uint16_t i = 0; i < n_bytes && i < 8; ++i) {
         data[byte_offset + i] |= (uint8_t)(insert_value >> (i * 8));
     }
+    if (n_bytes > 8) {
+        uint8_t high_mask = (uint8_t)(mask >> (64 - bit_offset));
+        data[byte_offset + 8] = (uint8_t)((data[byte_offset + 8] & ~high_mask) |
+                                          ((uint8_t)((value & mask) >> (64 - bit_offset)) & high_mask));
+    }
 }
 
 // Big-endian (Motorola) bit extraction (DBC semantics, sawtooth)
@@ -79,3 +101,5 @@ void set_bits_be(uint8_t* data, uint16_t start_bit, uint16_t length, uint64_t va
         data[curByte] = (uint8_t)((data[curByte] & (uint8_t)~(1u << curBit)) | (uint8_t)(bitval << curBit));
     }
 }
+
+
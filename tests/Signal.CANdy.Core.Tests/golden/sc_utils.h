@@ -26,6 +26,91 @@ void set_bits_be(uint8_t* data, uint16_t start_bit, uint16_t length, uint64_t va
 uint8_t canfd_dlc_to_len(uint8_t dlc);
 uint8_t canfd_len_to_dlc(uint8_t len);
 
+#ifdef SC_PROF
+/* Per-message decode/encode profiling; build every generated source with -DSC_PROF.
+   Each <MSG>_decode, <MSG>_decode_e2e and <MSG>_encode call is counted, accepted calls add their
+   latency to a log2 histogram, and rejected decodes are counted by reason. The stats live in one
+   contiguous array in message order (defined in the registry, see sc_prof_get).
+   SC_PROF_NOW() can be predefined as any monotonic uint64_t tick source; the default is
+   CLOCK_MONOTONIC in ns, or the time-stamp counter when SC_PROF_RDTSC is defined on x86.
+   Counters are plain integers: profile from one RX/TX context.
+   Without SC_PROF the hooks expand to nothing. */
+#define SC_PROF_MESSAGE_COUNT 1
+
+#ifndef SC_PROF_BUCKETS
+#define SC_PROF_BUCKETS 32
+#endif
+
+#ifndef SC_PROF_NOW
+#if defined(SC_PROF_RDTSC) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SC_PROF_NOW() ((uint64_t)__builtin_ia32_rdtsc())
+#define SC_PROF_UNIT "cycles"
+#else
+#define SC_PROF_CLOCK_GETTIME 1
+uint64_t sc_prof_now_ns(void);
+#define SC_PROF_NOW() sc_prof_now_ns()
+#define SC_PROF_UNIT "ns"
+#endif
+#endif
+
+#ifndef SC_PROF_UNIT
+#define SC_PROF_UNIT "ticks"
+#endif
+
+typedef struct {
+    uint64_t calls;
+    uint64_t ok;                      /* accepted calls; only these are timed */
+    uint64_t ticks;                   /* total latency of accepted calls */
+    uint64_t max_ticks;
+    uint32_t hist[SC_PROF_BUCKETS];   /* hist[0]: 0 ticks, hist[b]: [2^(b-1), 2^b); the last bucket is open */
+} sc_prof_op_t;
+
+typedef struct {
+    uint32_t id;
+    const char* name;
+    sc_prof_op_t decode;
+    sc_prof_op_t encode;              /* failed encodes (calls - ok) are range check failures */
+    uint64_t fail_length;             /* dlc shorter than the message */
+    uint64_t fail_crc;
+    uint64_t fail_counter;            /* _decode_e2e counter sequence errors */
+} sc_prof_stats_t;
+
+extern sc_prof_stats_t sc_prof_stats[SC_PROF_MESSAGE_COUNT];
+extern uint64_t sc_prof_unknown_ids;  /* decode_message calls for IDs not in the registry */
+
+static inline uint64_t sc_prof_begin(sc_prof_op_t* op) {
+    op->calls++;
+    return SC_PROF_NOW();
+}
+
+static inline void sc_prof_end(sc_prof_op_t* op, uint64_t t0) {
+    uint64_t dt = SC_PROF_NOW() - t0;
+    unsigned b = 0;
+    for (uint64_t v = dt; v != 0u && b < SC_PROF_BUCKETS - 1u; v >>= 1) {
+        b++;
+    }
+    op->ok++;
+    op->ticks += dt;
+    if (dt > op->max_ticks) op->max_ticks = dt;
+    op->hist[b]++;
+}
+
+/* Rejected decodes not caused by length, CRC or counter: physical range checks. */
+static inline uint64_t sc_prof_fail_range(const sc_prof_stats_t* s) {
+    return s->decode.calls - s->decode.ok - s->fail_length - s->fail_crc - s->fail_counter;
+}
+
+#define SC_PROF_BEGIN(slot, op) const uint64_t sc_prof_t0 = sc_prof_begin(&sc_prof_stats[(slot)].op)
+#define SC_PROF_END(slot, op) sc_prof_end(&sc_prof_stats[(slot)].op, sc_prof_t0)
+#define SC_PROF_FAIL(slot, reason) (sc_prof_stats[(slot)].fail_##reason++)
+#define SC_PROF_UNKNOWN_ID() (sc_prof_unknown_ids++)
+#else
+#define SC_PROF_BEGIN(slot, op) ((void)0)
+#define SC_PROF_END(slot, op) ((void)0)
+#define SC_PROF_FAIL(slot, reason) ((void)0)
+#define SC_PROF_UNKNOWN_ID() ((void)0)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
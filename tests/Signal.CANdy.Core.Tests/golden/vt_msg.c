@@ -34,7 +34,8 @@ const char* VT_MSG_Error_to_string(int v) {
 }
 
 bool VT_MSG_decode(VT_MSG_t* msg, const uint8_t data[], uint8_t dlc) {
-    if (dlc < 8) { return false; }
+    SC_PROF_BEGIN(0, decode);
+    if (dlc < 8) { SC_PROF_FAIL(0, length); return false; }
     msg->valid = 0u;
 
     uint64_t raw_Mode = 0;
@@ -68,10 +69,12 @@ bool VT_MSG_decode(VT_MSG_t* msg, const uint8_t data[], uint8_t dlc) {
     if (msg->Error < 0 || msg->Error > 255) { return false; }
     msg->valid |= VT_MSG_VALID_ERROR;
     }
+    SC_PROF_END(0, decode);
     return true;
 }
 
 bool VT_MSG_encode(uint8_t data[], uint8_t* out_dlc, const VT_MSG_t* msg) {
+    SC_PROF_BEGIN(0, encode);
     memset(data, 0, 8);
     *out_dlc = 8;
     if (msg->Mode < 0 || msg->Mode > 255) { return false; }
@@ -98,5 +101,6 @@ bool VT_MSG_encode(uint8_t data[], uint8_t* out_dlc, const VT_MSG_t* msg) {
     int64_t raw_Error = (int64_t)(tmp_Error >= 0 ? tmp_Error + 0.5 : tmp_Error - 0.5);
     set_bits_le(data, 24, 8, (uint64_t)raw_Error);
     }
+    SC_PROF_END(0, encode);
     return true;
 }
@@ -5,7 +5,6 @@ from datetime import datetime, timezone
 import importlib
 import json
 import logging
-import os
 from pathlib import Path
 import math
 import random
@@ -15,7 +14,13 @@ import subprocess
 from typing import Any
 
 from . import tolerance as tolerance_module
-from .harness import MessageInfo, compile_harness, generate_harness_c, run_harness
+from .harness import (
+    MessageInfo,
+    compile_harness,
+    generate_harness_c,
+    harness_library_name,
+    run_harness,
+)
 
 
 LOGGER = logging.getLogger(__name__)
@@ -353,7 +358,7 @@ def extract_message_info(gen_dir: str) -> list[MessageInfo]:
     return messages
 
 
-def build_oracle_binary(gen_dir: str, messages: list[MessageInfo]) -> str:
+def build_oracle_library(gen_dir: str, messages: list[MessageInfo]) -> str:
     gen_path = Path(gen_dir)
     include_dir = gen_path / "include"
     src_dir = gen_path / "src"
@@ -361,12 +366,11 @@ def build_oracle_binary(gen_dir: str, messages: list[MessageInfo]) -> str:
         return ""
 
     harness_source = generate_harness_c(messages, str(include_dir), str(src_dir))
-    binary_name = "oracle_harness.exe" if os.name == "nt" else "oracle_harness"
-    binary_path = gen_path / "build" / binary_name
-    if not compile_harness(harness_source, str(gen_path), str(binary_path)):
+    library_path = gen_path / "build" / harness_library_name()
+    if not compile_harness(harness_source, str(gen_path), str(library_path)):
         return ""
 
-    return str(binary_path)
+    return str(library_path)
 
 
 def _message_by_name(db: Any, message_name: str) -> Any | None:
@@ -1072,7 +1076,7 @@ def _encode_results(
 
 
 def run_oracle_test(
-    db: Any, binary: str, vectors: list[TestVector]
+    db: Any, library: str, vectors: list[TestVector]
 ) -> list[TestResult]:
     results: list[TestResult] = []
     if not vectors:
@@ -1137,7 +1141,7 @@ def run_oracle_test(
     if not commands:
         return results
 
-    responses = run_harness(binary, commands)
+    responses = run_harness(library, commands)
     if len(responses) < len(order):
         responses.extend(
             [{"ok": False, "error": "harness produced fewer responses than commands"}]
@@ -1212,8 +1216,8 @@ def oracle_pipeline(
         report.write_json(report_path)
         return report
 
-    binary = build_oracle_binary(str(out_path), messages)
-    if not binary:
+    library = build_oracle_library(str(out_path), messages)
+    if not library:
         report = _report_from_results(
             dbc_full,
             config_full,
@@ -1228,7 +1232,7 @@ def oracle_pipeline(
         messages,
         vectors_per_signal=vectors_per_signal,
     )
-    execution_results = run_oracle_test(db, binary, vectors)
+    execution_results = run_oracle_test(db, library, vectors)
     all_results = [*skipped_results, *execution_results]
 
     report = _report_from_results(dbc_full, config_full, timestamp, all_results)
@@ -1,9 +1,13 @@
 from __future__ import annotations
 
+from array import array
+import ctypes
 from dataclasses import dataclass
-import json
+import os
 from pathlib import Path
+import shutil
 import subprocess
+import sys
 from typing import Any
 
 
@@ -59,119 +63,56 @@ def _build_includes(messages: list[MessageInfo], include_dir: Path) -> str:
     return "\n".join(lines)
 
 
-def _build_signal_to_json(messages: list[MessageInfo]) -> str:
+def _build_message_functions(messages: list[MessageInfo]) -> str:
     lines: list[str] = []
 
     for index, message in enumerate(messages):
-        branch = "if" if index == 0 else "else if"
-        lines.append(f'    {branch} (strcmp(msg_name, "{message.name}") == 0) {{')
-        lines.append(
-            f"        const {message.name}_t* msg = (const {message.name}_t*)msg_value;"
-        )
-
         if message.signals:
-            format_parts = [
-                f'"{signal_name}": %f' for signal_name, _ in message.signals
-            ]
-            format_literal = _escape_c_string(", ".join(format_parts))
-            value_args = ", ".join(
-                f"msg->{signal_name}" for signal_name, _ in message.signals
-            )
-            lines.append(
-                f'        int written = snprintf(out, out_len, "{format_literal}", {value_args});'
-            )
+            names = ", ".join(f'"{_escape_c_string(name)}"' for name, _ in message.signals)
+            lines.append(f"static const char* const oracle_signals_{index}[] = {{ {names} }};")
         else:
-            lines.append('        int written = snprintf(out, out_len, "");')
-
-        lines.append("        return written >= 0 && (size_t)written < out_len;")
-        lines.append("    }")
-
-    return "\n".join(lines)
-
-
-def _build_json_to_signal(messages: list[MessageInfo]) -> str:
-    lines: list[str] = []
+            lines.append(f"static const char* const oracle_signals_{index}[] = {{ NULL }};")
+        lines.append("")
 
-    for index, message in enumerate(messages):
-        branch = "if" if index == 0 else "else if"
-        lines.append(f'    {branch} (strcmp(msg_name, "{message.name}") == 0) {{')
-        lines.append(f"        {message.name}_t* msg = ({message.name}_t*)msg_value;")
-
-        if message.signals:
-            lines.append("        float parsed_value = 0.0f;")
-            for signal_name, _ in message.signals:
-                lines.append(
-                    f'        if (!json_get_signal_float(signals_json, "{signal_name}", &parsed_value)) {{'
-                )
-                lines.append(
-                    f'            snprintf(error, error_len, "missing signal {signal_name} for {message.name}");'
-                )
-                lines.append("            return false;")
-                lines.append("        }")
-                lines.append(f"        msg->{signal_name} = parsed_value;")
-
-        lines.append("        return true;")
-        lines.append("    }")
-
-    return "\n".join(lines)
-
-
-def _build_decode_dispatch(messages: list[MessageInfo]) -> str:
-    lines: list[str] = []
-
-    for index, message in enumerate(messages):
-        branch = "if" if index == 0 else "else if"
-        lines.append(f'    {branch} (strcmp(msg_name, "{message.name}") == 0) {{')
-        lines.append(f"        {message.name}_t msg = {{0}};")
-        lines.append("        char signals_json[ORACLE_LINE_CAPACITY];")
-        lines.append("        int written = 0;")
-        lines.append(f"        if (!{message.name}_decode(&msg, data, dlc)) {{")
         lines.append(
-            f'            snprintf(error, error_len, "decode failed for {message.name}");'
+            f"static bool oracle_decode_{index}(const uint8_t* data, uint8_t dlc, double* values) {{"
         )
-        lines.append("            return false;")
-        lines.append("        }")
-        lines.append(
-            f'        if (!signals_to_json("{message.name}", &msg, signals_json, sizeof(signals_json))) {{'
-        )
-        lines.append(
-            f'            snprintf(error, error_len, "signal serialization failed for {message.name}");'
-        )
-        lines.append("            return false;")
-        lines.append("        }")
-        lines.append(
-            '        written = snprintf(out_json, out_json_len, "{\\"ok\\": true, \\"signals\\": {%s}}", signals_json);'
-        )
-        lines.append("        return written >= 0 && (size_t)written < out_json_len;")
+        lines.append(f"    {message.name}_t msg = {{0}};")
+        if not message.signals:
+            lines.append("    (void)values;")
+        lines.append(f"    if (!{message.name}_decode(&msg, data, dlc)) {{")
+        lines.append("        return false;")
         lines.append("    }")
+        for signal_index, (signal_name, _) in enumerate(message.signals):
+            lines.append(f"    values[{signal_index}] = (double)msg.{signal_name};")
+        lines.append("    return true;")
+        lines.append("}")
+        lines.append("")
 
-    return "\n".join(lines)
-
-
-def _build_encode_dispatch(messages: list[MessageInfo]) -> str:
-    lines: list[str] = []
-
-    for index, message in enumerate(messages):
-        branch = "if" if index == 0 else "else if"
-        lines.append(f'    {branch} (strcmp(msg_name, "{message.name}") == 0) {{')
-        lines.append(f"        {message.name}_t msg = {{0}};")
-        lines.append(
-            f'        if (!json_to_signal("{message.name}", signals_json, &msg, error, error_len)) {{'
-        )
-        lines.append("            return false;")
-        lines.append("        }")
-        lines.append(f"        if (!{message.name}_encode(data, out_dlc, &msg)) {{")
         lines.append(
-            f'            snprintf(error, error_len, "encode failed for {message.name}");'
+            f"static bool oracle_encode_{index}(const double* values, uint8_t* data, uint8_t* out_dlc) {{"
         )
-        lines.append("            return false;")
-        lines.append("        }")
-        lines.append("        return true;")
-        lines.append("    }")
+        lines.append(f"    {message.name}_t msg = {{0}};")
+        if not message.signals:
+            lines.append("    (void)values;")
+        for signal_index, (signal_name, signal_type) in enumerate(message.signals):
+            lines.append(f"    msg.{signal_name} = ({signal_type})values[{signal_index}];")
+        lines.append(f"    return {message.name}_encode(data, out_dlc, &msg);")
+        lines.append("}")
+        lines.append("")
 
     return "\n".join(lines)
 
 
+def _build_message_table(messages: list[MessageInfo]) -> str:
+    rows = [
+        f'    {{ "{_escape_c_string(message.name)}", {len(message.signals)}u, oracle_signals_{index}, '
+        f"oracle_decode_{index}, oracle_encode_{index} }}"
+        for index, message in enumerate(messages)
+    ]
+    return ",\n".join(rows)
+
+
 def generate_harness_c(
     messages: list[MessageInfo], include_dir: str, src_dir: str
 ) -> str:
@@ -182,10 +123,8 @@ def generate_harness_c(
 
     replacements = {
         "{{INCLUDES}}": _build_includes(messages, include_path),
-        "{{DECODE_DISPATCH}}": _build_decode_dispatch(messages),
-        "{{ENCODE_DISPATCH}}": _build_encode_dispatch(messages),
-        "{{SIGNAL_TO_JSON}}": _build_signal_to_json(messages),
-        "{{JSON_TO_SIGNAL}}": _build_json_to_signal(messages),
+        "{{MESSAGE_FUNCTIONS}}": _build_message_functions(messages),
+        "{{MESSAGE_TABLE}}": _build_message_table(messages),
     }
 
     harness_text = template_text
@@ -197,11 +136,19 @@ def generate_harness_c(
     return str(output_path)
 
 
-def compile_harness(c_source: str, gen_dir: str, output_binary: str) -> bool:
+def harness_library_name() -> str:
+    if os.name == "nt":
+        return "oracle_harness.dll"
+    if sys.platform == "darwin":
+        return "liboracle_harness.dylib"
+    return "liboracle_harness.so"
+
+
+def compile_harness(c_source: str, gen_dir: str, output_library: str) -> bool:
     gen_path = Path(gen_dir)
     include_path = gen_path / "include"
     source_path = Path(c_source)
-    output_path = Path(output_binary)
+    output_path = Path(output_library)
 
     if not source_path.exists() or not include_path.exists():
         return False
@@ -218,6 +165,9 @@ def compile_harness(c_source: str, gen_dir: str, output_binary: str) -> bool:
         "-std=c99",
         "-Wall",
         "-Wextra",
+        "-O2",
+        "-shared",
+        *([] if os.name == "nt" else ["-fPIC"]),
         f"-I{include_path}",
         "-o",
         str(output_path),
@@ -239,72 +189,283 @@ def compile_harness(c_source: str, gen_dir: str, output_binary: str) -> bool:
     return result.returncode == 0
 
 
-def run_harness(binary: str, commands: list[dict]) -> list[dict]:
-    binary_path = Path(binary)
-    if not binary_path.exists():
-        return [{"ok": False, "error": f"harness binary not found: {binary_path}"}]
+class HarnessLibrary:
+    """Compiled oracle_harness.c loaded in-process; vectors go through in batches per message."""
+
+    def __init__(self, path: str) -> None:
+        lib = ctypes.CDLL(path)
+
+        lib.oracle_payload_capacity.restype = ctypes.c_size_t
+        lib.oracle_payload_capacity.argtypes = []
+        lib.oracle_message_count.restype = ctypes.c_size_t
+        lib.oracle_message_count.argtypes = []
+        lib.oracle_message_name.restype = ctypes.c_char_p
+        lib.oracle_message_name.argtypes = [ctypes.c_size_t]
+        lib.oracle_signal_count.restype = ctypes.c_size_t
+        lib.oracle_signal_count.argtypes = [ctypes.c_size_t]
+        lib.oracle_signal_name.restype = ctypes.c_char_p
+        lib.oracle_signal_name.argtypes = [ctypes.c_size_t, ctypes.c_size_t]
+        lib.oracle_decode_batch.restype = ctypes.c_long
+        lib.oracle_decode_batch.argtypes = [
+            ctypes.c_size_t,
+            ctypes.c_void_p,
+            ctypes.c_void_p,
+            ctypes.c_size_t,
+            ctypes.c_void_p,
+            ctypes.c_void_p,
+        ]
+        lib.oracle_encode_batch.restype = ctypes.c_long
+        lib.oracle_encode_batch.argtypes = [
+            ctypes.c_size_t,
+            ctypes.c_void_p,
+            ctypes.c_size_t,
+            ctypes.c_void_p,
+            ctypes.c_void_p,
+            ctypes.c_void_p,
+        ]
+
+        self._lib = lib
+        self.payload_capacity = int(lib.oracle_payload_capacity())
+        self.signals: dict[str, list[str]] = {}
+        self._indices: dict[str, int] = {}
+        for index in range(int(lib.oracle_message_count())):
+            name = lib.oracle_message_name(index).decode("utf-8")
+            if name in self._indices:
+                continue
+            self._indices[name] = index
+            self.signals[name] = [
+                lib.oracle_signal_name(index, signal).decode("utf-8")
+                for signal in range(int(lib.oracle_signal_count(index)))
+            ]
 
-    try:
-        process = subprocess.Popen(
-            [str(binary_path)],
-            stdin=subprocess.PIPE,
-            stdout=subprocess.PIPE,
-            stderr=subprocess.PIPE,
-            text=True,
+    def has_message(self, message: str) -> bool:
+        return message in self._indices
+
+    def decode_batch(
+        self, message: str, payloads: list[bytes]
+    ) -> list[list[float] | None]:
+        """Decoded signal values per payload (in self.signals order), None where decode failed."""
+        index = self._indices[message]
+        width = len(self.signals[message])
+        count = len(payloads)
+        if count == 0:
+            return []
+
+        stride = self.payload_capacity
+        frames = bytearray(count * stride)
+        dlcs = bytearray(count)
+        for row, payload in enumerate(payloads):
+            length = min(len(payload), stride)
+            frames[row * stride : row * stride + length] = payload[:length]
+            dlcs[row] = length
+
+        values = array("d", bytes(8 * max(1, count * width)))
+        ok = bytearray(count)
+        self._lib.oracle_decode_batch(
+            index,
+            _address(frames),
+            _address(dlcs),
+            count,
+            _address(values),
+            _address(ok),
         )
-    except OSError as ex:
-        return [{"ok": False, "error": str(ex)}]
 
-    if process.stdin is None or process.stdout is None:
-        process.kill()
-        return [{"ok": False, "error": "failed to open harness stdin/stdout pipes"}]
+        return [
+            values[row * width : (row + 1) * width].tolist() if ok[row] else None
+            for row in range(count)
+        ]
+
+    def encode_batch(
+        self, message: str, rows: list[list[float]]
+    ) -> list[bytes | None]:
+        """Encoded payload (dlc bytes) per row of signal values, None where encode failed."""
+        index = self._indices[message]
+        width = len(self.signals[message])
+        count = len(rows)
+        if count == 0:
+            return []
+
+        values = array("d", bytes(8 * max(1, count * width)))
+        for row, row_values in enumerate(rows):
+            values[row * width : (row + 1) * width] = array("d", row_values)
+
+        stride = self.payload_capacity
+        frames = bytearray(count * stride)
+        dlcs = bytearray(count)
+        ok = bytearray(count)
+        self._lib.oracle_encode_batch(
+            index,
+            _address(values),
+            count,
+            _address(frames),
+            _address(dlcs),
+            _address(ok),
+        )
 
-    responses: list[dict[str, Any]] = []
+        return [
+            bytes(frames[row * stride : row * stride + dlcs[row]]) if ok[row] else None
+            for row in range(count)
+        ]
 
-    for command in commands:
-        payload = json.dumps(command, separators=(",", ":"))
-        process.stdin.write(payload + "\n")
-        process.stdin.flush()
 
-        line = process.stdout.readline()
-        if line == "":
-            responses.append({"ok": False, "error": "harness exited without response"})
-            break
+def _address(buffer: bytearray | array) -> int:
+    return ctypes.addressof(ctypes.c_char.from_buffer(buffer))
 
-        line = line.strip()
-        if line == "":
-            responses.append({"ok": False, "error": "empty response from harness"})
-            continue
 
+# dlopen() hands back an already loaded library for the same path, so a rebuilt
+# library at a path loaded before is loaded from a copy named after its mtime.
+# Only the newest copy per path is kept on disk.
+_LOADED: dict[str, tuple[int, Path, HarnessLibrary]] = {}
+
+
+def load_harness(path: str) -> HarnessLibrary:
+    library_path = Path(path).resolve()
+    stamp = library_path.stat().st_mtime_ns
+    key = str(library_path)
+
+    cached = _LOADED.get(key)
+    if cached is not None and cached[0] == stamp:
+        return cached[2]
+
+    load_path = library_path
+    if cached is not None:
+        load_path = library_path.with_name(
+            f"{library_path.stem}-{stamp}{library_path.suffix}"
+        )
+        shutil.copyfile(library_path, load_path)
+
+    library = HarnessLibrary(str(load_path))
+    _LOADED[key] = (stamp, load_path, library)
+
+    if cached is not None and cached[1] != library_path:
+        # A mapped library can be unlinked on POSIX; Windows keeps it locked.
         try:
-            parsed = json.loads(line)
-        except json.JSONDecodeError:
-            responses.append(
-                {"ok": False, "error": "invalid JSON response", "raw": line}
-            )
+            cached[1].unlink()
+        except OSError:
+            pass
+
+    return library
+
+
+def run_harness(library_path: str, commands: list[dict]) -> list[dict]:
+    """Runs decode/encode commands through the harness library, batched per message and action.
+
+    Commands and responses keep the shape of the former stdin/stdout protocol:
+    {"message", "action": "decode", "data", "dlc"} -> {"ok", "signals"} and
+    {"message", "action": "encode", "signals"} -> {"ok", "data", "dlc"}.
+    """
+    path = Path(library_path)
+    if not path.exists():
+        return [{"ok": False, "error": f"harness library not found: {path}"}]
+
+    try:
+        library = load_harness(str(path))
+    except (OSError, AttributeError) as ex:
+        return [{"ok": False, "error": str(ex)}]
+
+    responses: list[dict[str, Any]] = [{} for _ in commands]
+    decode_batches: dict[str, list[tuple[int, bytes]]] = {}
+    encode_batches: dict[str, list[tuple[int, list[float]]]] = {}
+
+    for position, command in enumerate(commands):
+        message = str(command.get("message", ""))
+        action = command.get("action")
+
+        if not message or action not in ("decode", "encode"):
+            responses[position] = {
+                "ok": False,
+                "error": "missing message or action field"
+                if not message or action is None
+                else "unknown action",
+            }
             continue
 
-        if isinstance(parsed, dict):
-            responses.append(parsed)
-        else:
-            responses.append(
-                {"ok": False, "error": "response is not a JSON object", "raw": parsed}
-            )
+        if not library.has_message(message):
+            responses[position] = {
+                "ok": False,
+                "error": f"unknown message for {action}: {message}",
+            }
+            continue
 
-    process.stdin.close()
-    process.wait()
+        if action == "decode":
+            payload = _command_payload(command, library.payload_capacity)
+            if isinstance(payload, str):
+                responses[position] = {"ok": False, "error": payload}
+                continue
+            decode_batches.setdefault(message, []).append((position, payload))
+            continue
 
-    stderr_text = ""
-    if process.stderr is not None:
-        stderr_text = process.stderr.read().strip()
+        signals = command.get("signals")
+        if not isinstance(signals, dict):
+            responses[position] = {"ok": False, "error": "missing signals object"}
+            continue
 
-    if process.returncode != 0:
-        responses.append(
-            {
+        missing = [name for name in library.signals[message] if name not in signals]
+        if missing:
+            responses[position] = {
                 "ok": False,
-                "error": stderr_text
-                or f"harness process exited with code {process.returncode}",
+                "error": f"missing signal {missing[0]} for {message}",
             }
-        )
+            continue
+
+        try:
+            row = [float(signals[name]) for name in library.signals[message]]
+        except (TypeError, ValueError):
+            responses[position] = {
+                "ok": False,
+                "error": f"non-numeric signal value for {message}",
+            }
+            continue
+        encode_batches.setdefault(message, []).append((position, row))
+
+    for message, batch in decode_batches.items():
+        names = library.signals[message]
+        decoded = library.decode_batch(message, [payload for _, payload in batch])
+        for (position, _), values in zip(batch, decoded):
+            if values is None:
+                responses[position] = {
+                    "ok": False,
+                    "error": f"decode failed for {message}",
+                }
+            else:
+                responses[position] = {"ok": True, "signals": dict(zip(names, values))}
+
+    for message, batch in encode_batches.items():
+        encoded = library.encode_batch(message, [row for _, row in batch])
+        for (position, _), payload in zip(batch, encoded):
+            if payload is None:
+                responses[position] = {
+                    "ok": False,
+                    "error": f"encode failed for {message}",
+                }
+            else:
+                responses[position] = {
+                    "ok": True,
+                    "data": list(payload),
+                    "dlc": len(payload),
+                }
+
+    return responses
+
+
+def _command_payload(command: dict, capacity: int) -> bytes | str:
+    data = command.get("data")
+    if not isinstance(data, list) or len(data) > capacity:
+        return "invalid data array"
+
+    try:
+        payload = bytes(data)
+    except (TypeError, ValueError):
+        return "invalid data array"
+
+    dlc = command.get("dlc")
+    if not isinstance(dlc, int):
+        return "missing dlc field"
+
+    if dlc < 0 or dlc > capacity:
+        return "dlc out of range"
+
+    if len(data) < dlc:
+        return "data array shorter than dlc"
 
-    return [dict(response) for response in responses]
+    return payload[:dlc]
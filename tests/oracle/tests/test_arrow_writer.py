@@ -0,0 +1,115 @@
+from __future__ import annotations
+
+import ctypes
+from pathlib import Path
+import random
+import re
+
+import pytest
+
+from ..oracle.engine import build_oracle_library, extract_message_info, run_codegen
+from ..oracle.harness import load_harness
+
+pa = pytest.importorskip("pyarrow")
+ipc = pytest.importorskip("pyarrow.ipc")
+
+
+def _generate(tmp_path: Path, dbc_path: Path) -> tuple[str, list]:
+    config_path = tmp_path / f"{dbc_path.stem}.yaml"
+    config_path.write_text(
+        'phys_type: "float"\n'
+        'phys_mode: "double"\n'
+        "range_check: false\n"
+        'dispatch: "direct_map"\n'
+        'motorola_start_bit: "msb"\n'
+        "crc_counter_check: false\n"
+        "arrow_writer: true\n",
+        encoding="utf-8",
+    )
+    gen_dir = tmp_path / dbc_path.stem
+    assert run_codegen(str(dbc_path), str(config_path), str(gen_dir))
+    messages = extract_message_info(str(gen_dir))
+    assert messages
+    library = build_oracle_library(str(gen_dir), messages)
+    assert library
+    return library, messages
+
+
+def _frame_ids(dbc_path: Path) -> dict[str, int]:
+    pattern = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:", re.MULTILINE)
+    return {
+        name: int(frame_id)
+        for frame_id, name in pattern.findall(dbc_path.read_text(encoding="utf-8"))
+    }
+
+
+@pytest.mark.integration
+@pytest.mark.parametrize("dbc_fixture", ["comprehensive_dbc_path", "multiplex_dbc_path"])
+def test_arrow_writer_tables_read_back_with_pyarrow(
+    tmp_path: Path, request: pytest.FixtureRequest, dbc_fixture: str
+) -> None:
+    dbc_path: Path = request.getfixturevalue(dbc_fixture)
+    library_path, messages = _generate(tmp_path, dbc_path)
+    harness = load_harness(library_path)
+
+    # The harness library links every generated source, the Arrow writer included.
+    writer = ctypes.CDLL(library_path)
+    writer.arrow_writer_open.argtypes = [ctypes.c_char_p, ctypes.c_uint32]
+    writer.arrow_writer_open.restype = ctypes.c_bool
+    writer.arrow_writer_append.argtypes = [
+        ctypes.c_int64,
+        ctypes.c_uint32,
+        ctypes.c_char_p,
+        ctypes.c_uint8,
+    ]
+    writer.arrow_writer_append.restype = ctypes.c_int
+    writer.arrow_writer_close.restype = ctypes.c_int
+
+    out_dir = tmp_path / "tables"
+    out_dir.mkdir()
+    # A small batch size spreads each table over several record batches.
+    assert writer.arrow_writer_open(str(out_dir).encode(), 64)
+
+    rng = random.Random(11)
+    frame_ids = _frame_ids(dbc_path)
+    expected: dict[str, tuple[list[int], list[list[float]]]] = {}
+    time_us = 0
+    for message in messages:
+        frame_id = frame_ids[message.name]
+        payloads = [
+            bytes(rng.randrange(256) for _ in range(message.dlc)) for _ in range(150)
+        ]
+        decoded = harness.decode_batch(message.name, payloads)
+        times: list[int] = []
+        rows: list[list[float]] = []
+        for payload, values in zip(payloads, decoded):
+            time_us += 1000
+            status = writer.arrow_writer_append(time_us, frame_id, payload, len(payload))
+            if values is None:
+                assert status != 0, message.name
+                continue
+            assert status == 0, message.name
+            times.append(time_us)
+            rows.append(values)
+        expected[message.name] = (times, rows)
+
+    assert writer.arrow_writer_close() == 0
+
+    for name, (times, rows) in expected.items():
+        table = ipc.open_stream(pa.memory_map(str(out_dir / f"{name}.arrows"))).read_all()
+        assert table.num_rows == len(rows), name
+        assert table.column_names[0] == "time"
+        assert table.column("time").type == pa.timestamp("us")
+        assert table.column("time").cast(pa.int64()).to_pylist() == times
+
+        for position, signal in enumerate(harness.signals[name]):
+            column = table.column(signal)
+            assert column.type in (pa.int32(), pa.float32()), f"{name}.{signal}"
+            assert column.null_count < table.num_rows, f"{name}.{signal}"
+            # Float columns hold the decoded double narrowed to float32.
+            wanted = pa.array([row[position] for row in rows], pa.float64()).cast(
+                column.type, safe=False
+            )
+            for got, want in zip(column.to_pylist(), wanted.to_pylist()):
+                # Null marks a signal of an inactive multiplexed branch.
+                assert got is None or got == want, f"{name}.{signal}"
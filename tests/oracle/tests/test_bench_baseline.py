@@ -0,0 +1,146 @@
+from __future__ import annotations
+
+import json
+from pathlib import Path
+import shutil
+import subprocess
+
+import pytest
+
+
+REPO_ROOT = Path(__file__).resolve().parents[3]
+
+# bench -c exit codes: 2 when the baseline cannot be read, 3 when a loop regressed.
+_UNREADABLE = 2
+_REGRESSED = 3
+
+
+@pytest.fixture(scope="module")
+def bench_driver(tmp_path_factory: pytest.TempPathFactory) -> tuple[Path, dict]:
+    if shutil.which("dotnet") is None or shutil.which("make") is None:
+        pytest.skip("dotnet and make are required")
+    work = tmp_path_factory.mktemp("bench")
+    config_path = work / "bench.yaml"
+    config_path.write_text(
+        'phys_type: "float"\n'
+        'dispatch: "direct_map"\n'
+        'motorola_start_bit: "msb"\n',
+        encoding="utf-8",
+    )
+    gen_dir = work / "generated"
+    result = subprocess.run(
+        [
+            "dotnet",
+            "run",
+            "--project",
+            "src/Signal.CANdy.CLI",
+            "--",
+            "-d",
+            str(REPO_ROOT / "examples" / "comprehensive_test.dbc"),
+            "-o",
+            str(gen_dir),
+            "-c",
+            str(config_path),
+            "-t",
+        ],
+        check=False,
+        capture_output=True,
+        text=True,
+        cwd=REPO_ROOT,
+    )
+    assert result.returncode == 0, result.stderr
+
+    # make test builds the driver and writes a real --check report.
+    result = subprocess.run(
+        ["make", "-C", str(gen_dir), "test"], check=False, capture_output=True, text=True
+    )
+    assert result.returncode == 0, result.stdout + result.stderr
+    report = json.loads((gen_dir / "build" / "bench_check.json").read_text(encoding="utf-8"))
+    return gen_dir / "build" / "bench", report
+
+
+def _compare(bench: Path, baseline: Path) -> subprocess.CompletedProcess:
+    return subprocess.run(
+        [str(bench), "--check", "-c", str(baseline), "-o", str(baseline.with_suffix(".out.json"))],
+        check=False,
+        capture_output=True,
+        text=True,
+        encoding="utf-8",
+    )
+
+
+def _scaled(report: dict, factor: float) -> dict:
+    scaled = json.loads(json.dumps(report))
+    stats = [message[op] for message in scaled["messages"] for op in ("decode", "encode", "roundtrip")]
+    stats.append(scaled["registry"]["decode"])
+    for stat in stats:
+        stat["ns_op"] *= factor
+        stat["mad"] = 0.0
+    return scaled
+
+
+@pytest.mark.integration
+def test_faster_baseline_is_a_regression(tmp_path: Path, bench_driver) -> None:
+    bench, report = bench_driver
+    baseline = tmp_path / "fast.json"
+    baseline.write_text(json.dumps(_scaled(report, 0.01)), encoding="utf-8")
+
+    result = _compare(bench, baseline)
+    assert result.returncode == _REGRESSED, result.stderr
+    compared = json.loads(baseline.with_suffix(".out.json").read_text(encoding="utf-8"))
+    items = compared["comparison"]["items"]
+    assert items and all(item["status"] == "regressed" for item in items)
+
+
+@pytest.mark.integration
+def test_slower_baseline_is_not_a_regression(tmp_path: Path, bench_driver) -> None:
+    bench, report = bench_driver
+    baseline = tmp_path / "slow.json"
+    baseline.write_text(json.dumps(_scaled(report, 100.0)), encoding="utf-8")
+
+    result = _compare(bench, baseline)
+    assert result.returncode == 0, result.stderr
+    compared = json.loads(baseline.with_suffix(".out.json").read_text(encoding="utf-8"))
+    assert compared["comparison"]["regressed"] == 0
+    assert compared["comparison"]["improved"] > 0
+
+
+@pytest.mark.integration
+def test_escaped_strings_are_decoded(tmp_path: Path, bench_driver) -> None:
+    bench, report = bench_driver
+    scaled = _scaled(report, 0.01)
+    scaled["machine"]["cpu"] = "bench \U0001F600 é\tcpu"
+    # json.dumps escapes every non-ASCII character and the message names are spelled as \u escapes,
+    # so a match means the driver decoded them (an unmatched message would only be "new").
+    text = json.dumps(scaled)
+    for message in report["messages"]:
+        name = message["name"]
+        text = text.replace(f'"{name}"', '"' + "".join(f"\\u{ord(c):04x}" for c in name) + '"')
+    baseline = tmp_path / "escaped.json"
+    baseline.write_text(text, encoding="utf-8")
+
+    result = _compare(bench, baseline)
+    assert result.returncode == _REGRESSED, result.stderr
+    assert '"bench \U0001F600 é\tcpu"' in result.stderr
+
+
+@pytest.mark.integration
+@pytest.mark.parametrize(
+    "damage",
+    [
+        lambda r: r.update({"k" * 40: 1}),
+        lambda r: r.update({"config": "x" * 2000}),
+        lambda r: r["machine"].update({"cpu": "\ud800"}),
+    ],
+    ids=["long-key", "long-string", "lone-surrogate"],
+)
+def test_unreadable_baseline_is_rejected(tmp_path: Path, bench_driver, damage) -> None:
+    bench, report = bench_driver
+    broken = json.loads(json.dumps(report))
+    damage(broken)
+    baseline = tmp_path / "broken.json"
+    baseline.write_text(json.dumps(broken), encoding="utf-8")
+
+    result = _compare(bench, baseline)
+    assert result.returncode == _UNREADABLE
+    assert "not a benchmark report" in result.stderr
@@ -0,0 +1,100 @@
+from __future__ import annotations
+
+from pathlib import Path
+import random
+
+import pytest
+
+from ..oracle.engine import build_oracle_library, extract_message_info, run_codegen
+from ..oracle.harness import load_harness
+
+
+# Scales where float and double math round differently, decimal scales with and
+# without an integral offset (the fixed-point divisor path), and a signed field.
+_SCALES_DBC = """VERSION ""
+
+NS_ :
+
+BS_:
+
+BU_: ECU
+
+BO_ 300 SCALES: 8 ECU
+ SG_ Odd_32 : 0|32@1+ (0.37,-12.3) [-12.3|1589137899] "" ECU
+ SG_ Milli_S16 : 32|16@1- (0.001,0) [-32.768|32.767] "" ECU
+ SG_ Deci_12 : 48|12@1+ (0.1,5) [5|414.5] "" ECU
+ SG_ Quarter_4 : 60|4@1+ (0.25,0.3) [0.3|4.05] "" ECU
+
+BO_ 301 SCALES_BE: 8 ECU
+ SG_ Big_24 : 7|24@0+ (0.0123,-40) [-40|206308] "" ECU
+ SG_ Deci_S20 : 31|20@0- (0.01,0) [-5242.88|5242.87] "" ECU
+"""
+
+
+def _generate(
+    tmp_path: Path, dbc_path: Path, phys_type: str, phys_mode: str, style: str
+) -> str:
+    name = f"{phys_type}_{phys_mode}_{style}_{dbc_path.stem}"
+    config_path = tmp_path / f"{name}.yaml"
+    config_path.write_text(
+        f'phys_type: "{phys_type}"\n'
+        f'phys_mode: "{phys_mode}"\n'
+        "range_check: true\n"
+        'dispatch: "direct_map"\n'
+        'motorola_start_bit: "msb"\n'
+        "crc_counter_check: false\n"
+        f'codegen_style: "{style}"\n',
+        encoding="utf-8",
+    )
+    gen_dir = tmp_path / name
+    assert run_codegen(str(dbc_path), str(config_path), str(gen_dir))
+    messages = extract_message_info(str(gen_dir))
+    assert messages
+    library = build_oracle_library(str(gen_dir), messages)
+    assert library
+    return library
+
+
+@pytest.mark.integration
+@pytest.mark.slow
+@pytest.mark.parametrize(
+    ("phys_type", "phys_mode"),
+    [
+        ("float", "double"),
+        ("float", "float"),
+        ("float", "fixed_double"),
+        ("float", "fixed_float"),
+        ("fixed", "double"),
+        ("fixed", "float"),
+        ("fixed", "fixed_double"),
+        ("fixed", "fixed_float"),
+    ],
+)
+def test_codegen_style_table_matches_unrolled(
+    tmp_path: Path, multiplex_dbc_path: Path, phys_type: str, phys_mode: str
+) -> None:
+    scales_dbc = tmp_path / "scales.dbc"
+    scales_dbc.write_text(_SCALES_DBC, encoding="utf-8")
+    rng = random.Random(7)
+
+    for dbc_path in (scales_dbc, multiplex_dbc_path):
+        unrolled = load_harness(
+            _generate(tmp_path, dbc_path, phys_type, phys_mode, "unrolled")
+        )
+        table = load_harness(_generate(tmp_path, dbc_path, phys_type, phys_mode, "table"))
+        assert table.signals == unrolled.signals
+
+        for message, names in unrolled.signals.items():
+            payloads = [bytes(rng.randrange(256) for _ in range(8)) for _ in range(500)]
+            decoded = unrolled.decode_batch(message, payloads)
+            assert table.decode_batch(message, payloads) == decoded, message
+
+            rows = [values for values in decoded if values is not None]
+            # Values between raw steps exercise the rounding in encode.
+            rows += [
+                [value + rng.uniform(-0.5, 0.5) for value in values] for values in rows
+            ]
+            assert rows, message
+            assert table.encode_batch(message, rows) == unrolled.encode_batch(
+                message, rows
+            ), f"{message}: {names}"
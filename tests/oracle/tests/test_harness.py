@@ -10,6 +10,8 @@ from ..oracle.harness import (
     MessageInfo,
     compile_harness,
     generate_harness_c,
+    harness_library_name,
+    load_harness,
     run_harness,
 )
 
@@ -31,24 +33,16 @@ def _prepare_generated_sample(
     return gen_dir, source
 
 
-def _binary_path(gen_dir: Path) -> Path:
-    return (
-        gen_dir
-        / "build"
-        / ("oracle_harness.exe" if os.name == "nt" else "oracle_harness")
-    )
-
-
-def _build_sample_binary(
+def _build_sample_library(
     tmp_path: Path, sample_dbc_path: Path, default_config_path: Path
 ) -> tuple[Path, Path]:
     gen_dir, source = _prepare_generated_sample(
         tmp_path, sample_dbc_path, default_config_path
     )
-    binary = _binary_path(gen_dir)
-    assert compile_harness(source, str(gen_dir), str(binary))
-    assert binary.exists()
-    return gen_dir, binary
+    library = gen_dir / "build" / harness_library_name()
+    assert compile_harness(source, str(gen_dir), str(library))
+    assert library.exists()
+    return gen_dir, library
 
 
 def test_generate_harness_c_contains_dispatch_and_message_name(
@@ -80,25 +74,25 @@ def test_generate_harness_c_contains_dispatch_and_message_name(
 
 
 @pytest.mark.integration
-def test_generate_harness_c_compiles_with_generated_sources(
+def test_generate_harness_c_builds_shared_library_with_generated_sources(
     tmp_path: Path, sample_dbc_path: Path, default_config_path: Path
 ) -> None:
-    _, binary = _build_sample_binary(tmp_path, sample_dbc_path, default_config_path)
-    assert binary.exists()
+    _, library = _build_sample_library(tmp_path, sample_dbc_path, default_config_path)
+    assert library.exists()
 
 
 @pytest.mark.integration
-def test_json_protocol_decode_command_returns_signal_object(
+def test_harness_decode_command_returns_signal_object(
     cantools_module, tmp_path: Path, sample_dbc_path: Path, default_config_path: Path
 ) -> None:
     db = cantools_module.database.load_file(str(sample_dbc_path))
     message = db.get_message_by_name("MESSAGE_1")
     payload = message.encode({"Signal_1": 10.0, "Signal_2": 5.0}, strict=False)
 
-    _, binary = _build_sample_binary(tmp_path, sample_dbc_path, default_config_path)
+    _, library = _build_sample_library(tmp_path, sample_dbc_path, default_config_path)
 
     responses = run_harness(
-        str(binary),
+        str(library),
         [
             {
                 "message": "MESSAGE_1",
@@ -115,17 +109,17 @@ def test_json_protocol_decode_command_returns_signal_object(
 
 
 @pytest.mark.integration
-def test_json_protocol_encode_command_returns_payload(
+def test_harness_encode_command_returns_payload(
     cantools_module, tmp_path: Path, sample_dbc_path: Path, default_config_path: Path
 ) -> None:
     db = cantools_module.database.load_file(str(sample_dbc_path))
     message = db.get_message_by_name("MESSAGE_1")
     expected = bytes(message.encode({"Signal_1": 7.0, "Signal_2": 12.3}, strict=False))
 
-    _, binary = _build_sample_binary(tmp_path, sample_dbc_path, default_config_path)
+    _, library = _build_sample_library(tmp_path, sample_dbc_path, default_config_path)
 
     responses = run_harness(
-        str(binary),
+        str(library),
         [
             {
                 "message": "MESSAGE_1",
@@ -142,13 +136,13 @@ def test_json_protocol_encode_command_returns_payload(
 
 
 @pytest.mark.integration
-def test_json_protocol_unknown_message_returns_error(
+def test_harness_unknown_message_returns_error(
     tmp_path: Path, sample_dbc_path: Path, default_config_path: Path
 ) -> None:
-    _, binary = _build_sample_binary(tmp_path, sample_dbc_path, default_config_path)
+    _, library = _build_sample_library(tmp_path, sample_dbc_path, default_config_path)
 
     responses = run_harness(
-        str(binary),
+        str(library),
         [
             {
                 "message": "UNKNOWN_MESSAGE",
@@ -161,3 +155,54 @@ def test_json_protocol_unknown_message_returns_error(
     assert len(responses) == 1
     assert responses[0]["ok"] is False
     assert "unknown message" in responses[0]["error"].lower()
+
+
+@pytest.mark.integration
+def test_harness_batches_roundtrip_through_binary_buffers(
+    tmp_path: Path, sample_dbc_path: Path, default_config_path: Path
+) -> None:
+    _, library_path = _build_sample_library(
+        tmp_path, sample_dbc_path, default_config_path
+    )
+    library = load_harness(str(library_path))
+    assert library.signals["MESSAGE_1"] == ["Signal_1", "Signal_2"]
+
+    rows = [[float(index), float(index) / 2.0] for index in range(100)]
+    payloads = library.encode_batch("MESSAGE_1", rows)
+    assert all(payload is not None and len(payload) == 8 for payload in payloads)
+
+    decoded = library.decode_batch("MESSAGE_1", payloads)
+    assert decoded == rows
+
+    responses = run_harness(
+        str(library_path),
+        [
+            {"message": "MESSAGE_1", "action": "encode", "signals": {"Signal_1": 1.0}},
+            {"message": "MESSAGE_1", "action": "decode", "data": [0] * 4, "dlc": 8},
+        ],
+    )
+    assert responses[0] == {
+        "ok": False,
+        "error": "missing signal Signal_2 for MESSAGE_1",
+    }
+    assert responses[1] == {"ok": False, "error": "data array shorter than dlc"}
+
+
+@pytest.mark.integration
+def test_load_harness_keeps_only_the_newest_rebuild_copy(
+    tmp_path: Path, sample_dbc_path: Path, default_config_path: Path
+) -> None:
+    _, library_path = _build_sample_library(
+        tmp_path, sample_dbc_path, default_config_path
+    )
+    load_harness(str(library_path))
+
+    for rebuild in range(3):
+        # Stand-in for a rebuild: only the mtime matters to the cache.
+        stamp = library_path.stat().st_mtime_ns + (rebuild + 1) * 1_000_000_000
+        os.utime(library_path, ns=(stamp, stamp))
+        library = load_harness(str(library_path))
+        assert library.signals["MESSAGE_1"] == ["Signal_1", "Signal_2"]
+
+    copies = list(library_path.parent.glob(f"{library_path.stem}-*"))
+    assert len(copies) == 1
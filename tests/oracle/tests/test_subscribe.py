@@ -0,0 +1,125 @@
+from __future__ import annotations
+
+import ctypes
+from pathlib import Path
+
+import pytest
+
+from ..oracle.engine import build_oracle_library, extract_message_info, run_codegen
+
+
+# One little-endian and one Motorola switch, each selecting two branches that share bits.
+_MUX_DBC = """VERSION ""
+
+NS_ :
+
+BS_:
+
+BU_: ECU
+
+BO_ 200 MUX_LE: 8 ECU
+ SG_ Sw M : 0|4@1+ (1,0) [0|15] "" ECU
+ SG_ Base : 8|8@1+ (1,0) [0|255] "" ECU
+ SG_ A_m1 m1 : 16|8@1+ (1,0) [0|255] "" ECU
+ SG_ B_m2 m2 : 16|16@1+ (1,0) [0|65535] "" ECU
+
+BO_ 201 MUX_BE: 8 ECU
+ SG_ Sw M : 7|4@0+ (1,0) [0|15] "" ECU
+ SG_ Base : 15|8@0+ (1,0) [0|255] "" ECU
+ SG_ A_m5 m5 : 23|8@0+ (1,0) [0|255] "" ECU
+ SG_ B_m10 m10 : 23|16@0+ (1,0) [0|65535] "" ECU
+"""
+
+_SUBSCRIBE_ALL_SIGNALS = 0xFFFF
+
+_CALLBACK = ctypes.CFUNCTYPE(
+    None,
+    ctypes.c_uint32,
+    ctypes.c_void_p,
+    ctypes.POINTER(ctypes.c_uint16),
+    ctypes.c_uint16,
+    ctypes.c_void_p,
+)
+
+
+@pytest.fixture
+def subscribe_library(tmp_path: Path):
+    dbc_path = tmp_path / "mux.dbc"
+    dbc_path.write_text(_MUX_DBC, encoding="utf-8")
+    config_path = tmp_path / "subscribe.yaml"
+    config_path.write_text(
+        'phys_type: "float"\n'
+        'dispatch: "direct_map"\n'
+        'motorola_start_bit: "msb"\n'
+        "subscriptions: true\n",
+        encoding="utf-8",
+    )
+    gen_dir = tmp_path / "generated"
+    assert run_codegen(str(dbc_path), str(config_path), str(gen_dir))
+    messages = extract_message_info(str(gen_dir))
+    library_path = build_oracle_library(str(gen_dir), messages)
+    assert library_path
+
+    # The harness library links every generated source, the subscription layer included.
+    lib = ctypes.CDLL(library_path)
+    lib.subscribe_signal.argtypes = [ctypes.c_uint32, ctypes.c_uint16, _CALLBACK, ctypes.c_void_p]
+    lib.subscribe_signal.restype = ctypes.c_bool
+    lib.dispatch_frame.argtypes = [ctypes.c_uint32, ctypes.c_char_p, ctypes.c_uint8]
+    lib.dispatch_frame.restype = ctypes.c_int
+    lib.subscriptions_reset.restype = None
+    lib.subscriptions_reset()
+
+    reported: list[list[int]] = []
+
+    def on_change(_id, _msg, changed, count, _user) -> None:
+        reported.append([changed[i] for i in range(count)])
+
+    callback = _CALLBACK(on_change)
+
+    def dispatch(frame_id: int, data: bytes) -> list[int]:
+        reported.clear()
+        assert lib.dispatch_frame(frame_id, data, len(data)) >= 0
+        return reported[0] if reported else []
+
+    assert lib.subscribe_signal(200, _SUBSCRIBE_ALL_SIGNALS, callback, None)
+    assert lib.subscribe_signal(201, _SUBSCRIBE_ALL_SIGNALS, callback, None)
+    yield dispatch
+    lib.subscriptions_reset()
+
+
+# Signal indices follow DBC order: Sw, Base, branch 1 signal, branch 2 signal.
+@pytest.mark.integration
+@pytest.mark.parametrize(
+    ("frame_id", "first", "second"),
+    [
+        (200, bytes([1, 7, 0x11, 0x22, 0, 0, 0, 0]), bytes([2, 7, 0x11, 0x22, 0, 0, 0, 0])),
+        (201, bytes([0x50, 7, 0x11, 0x22, 0, 0, 0, 0]), bytes([0xA0, 7, 0x11, 0x22, 0, 0, 0, 0])),
+    ],
+)
+def test_switch_toggle_reports_only_the_newly_selected_branch(
+    subscribe_library, frame_id: int, first: bytes, second: bytes
+) -> None:
+    dispatch = subscribe_library
+
+    # First frame: everything live is new; the unselected branch stays quiet.
+    assert dispatch(frame_id, first) == [0, 1, 2]
+    assert dispatch(frame_id, first) == []
+
+    # Only the switch moves: the old branch goes inactive and is not reported, even though
+    # its bits are shared with the new branch.
+    assert dispatch(frame_id, second) == [0, 3]
+
+    # Branch bits change under a fixed switch: only the selected branch signal is reported.
+    changed = bytearray(second)
+    changed[2] ^= 0xFF
+    assert dispatch(frame_id, bytes(changed)) == [3]
+
+    # Switching back selects branch 1 again, reported whole with unchanged bits.
+    back = bytearray(changed)
+    back[0] = first[0]
+    assert dispatch(frame_id, bytes(back)) == [0, 2]
+
+    # Bits outside the selected branch (byte 3 belongs to branch 2 only) are ignored.
+    other = bytearray(back)
+    other[3] ^= 0xFF
+    assert dispatch(frame_id, bytes(other)) == []